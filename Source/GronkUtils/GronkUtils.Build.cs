@@ -34,8 +34,19 @@ public class GronkUtils : ModuleRules
 			new string[]
 			{
 				"CoreUObject",
-				"Engine"
+				"Engine",
+				"Json"
 			}
 		);
+
+		// SQLiteCore is an optional plugin, so the SQLite output is only compiled in where the engine ships it.
+		bool bWithSqlite = Directory.Exists(Path.Combine(EngineDirectory, "Plugins", "Runtime", "Database", "SQLiteCore"));
+		if (bWithSqlite)
+		{
+			PrivateDependencyModuleNames.Add("SQLiteCore");
+		}
+		PrivateDefinitions.Add("WITH_GRONK_SQLITE=" + (bWithSqlite ? "1" : "0"));
+
+		SetupGameplayDebuggerSupport(Target);
 	}
 }
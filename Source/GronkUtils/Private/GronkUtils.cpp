@@ -5,9 +5,74 @@
  */
 
 #include "GronkUtils.h"
+#include "LoggerActorQuota.h"
+#include "LoggerDownsample.h"
+#include "LoggerEscalation.h"
+#include "LoggerGameplayDebuggerCategory.h"
+#include "LoggerHeatmap.h"
+#include "LoggerHeavyHitters.h"
+#include "LoggerQuantiles.h"
+#include "LoggerSessionStats.h"
+#include "LoggerSink.h"
+#include "LoggerTrace.h"
 
-void FGronkUtilsModule::StartupModule() {}
+#if WITH_GAMEPLAY_DEBUGGER
+#include "GameplayDebugger.h"
+#endif
 
-void FGronkUtilsModule::ShutdownModule() {}
+void FGronkUtilsModule::StartupModule()
+{
+	FLoggerSessionStats::StartSession();
 
-IMPLEMENT_MODULE(FGronkUtilsModule, GronkUtils)
\ No newline at end of file
+#if WITH_GAMEPLAY_DEBUGGER
+	IGameplayDebugger& GameplayDebugger = IGameplayDebugger::Get();
+	GameplayDebugger.RegisterCategory(FLoggerGameplayDebuggerCategory::CategoryName,
+		IGameplayDebugger::FOnGetCategory::CreateStatic(&FLoggerGameplayDebuggerCategory::MakeInstance),
+		EGameplayDebuggerCategoryState::EnabledInGameAndSimulate);
+	GameplayDebugger.NotifyCategoriesChanged();
+#endif
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGronkUtilsModule::Tick));
+}
+
+void FGronkUtilsModule::ShutdownModule()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+#if WITH_GAMEPLAY_DEBUGGER
+	if (IGameplayDebugger::IsAvailable())
+	{
+		IGameplayDebugger& GameplayDebugger = IGameplayDebugger::Get();
+		GameplayDebugger.UnregisterCategory(FLoggerGameplayDebuggerCategory::CategoryName);
+		GameplayDebugger.NotifyCategoriesChanged();
+	}
+#endif
+
+	FLoggerTrace::Stop();
+	FLoggerHeatmap::Get().Flush(true);
+	if (FLoggerQuantiles::IsEnabled())
+	{
+		FLoggerQuantiles::Flush();
+	}
+	if (FLoggerDownsample::IsEnabled())
+	{
+		FLoggerDownsample::Flush();
+	}
+
+	FLoggerSessionStats::WriteSummary();
+	FLoggerSinks::Shutdown();
+}
+
+bool FGronkUtilsModule::Tick(float DeltaTime)
+{
+	FLoggerHeatmap::Get().Tick(DeltaTime);
+	FLoggerQuantiles::Tick(DeltaTime);
+	FLoggerDownsample::Tick(DeltaTime);
+	FLoggerHeavyHitters::Tick(DeltaTime);
+	FLoggerEscalation::Tick();
+	FLoggerActorQuota::Tick();
+	FLoggerSinks::Tick(DeltaTime);
+	return true;
+}
+
+IMPLEMENT_MODULE(FGronkUtilsModule, GronkUtils)
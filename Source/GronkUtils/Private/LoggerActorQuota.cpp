@@ -0,0 +1,235 @@
+/**
+ * @file		LoggerActorQuota.cpp
+ * @brief		Limits the number of records each actor can log per second.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerActorQuota.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "LoggerLog.h"
+#include "Misc/ScopeLock.h"
+
+void FLoggerActorQuota::Configure(int32 InRecordsPerSecond)
+{
+	FScopeLock ScopeLock(&Lock);
+	RecordsPerSecond.store(FMath::Clamp(InRecordsPerSecond, 0, static_cast<int32>(MAX_uint16)), std::memory_order_relaxed);
+	Slots.Empty();
+	NumUsed = 0;
+}
+
+bool FLoggerActorQuota::IsOverQuota(const UObject* Caller, ELoggerLevel Level)
+{
+	const int32 Quota = RecordsPerSecond.load(std::memory_order_relaxed);
+	if (Quota <= 0 || Level == ELoggerLevel::Fatal)
+	{
+		return false;
+	}
+
+	const FObjectKey Key = GetQuotaKey(Caller);
+	const uint32 Second = GetCurrentSecond();
+	const int32 LevelIndex = static_cast<int32>(Level);
+
+	FScopeLock ScopeLock(&Lock);
+	FSlot* Slot = FindSlot(Key, false);
+	if (!Slot || Slot->Second != Second || Slot->Counts[LevelIndex] < Quota)
+	{
+		return false;
+	}
+
+	++Slot->Suppressed[LevelIndex];
+	return true;
+}
+
+bool FLoggerActorQuota::TryConsume(const UObject* Caller, ELoggerLevel Level)
+{
+	const int32 Quota = RecordsPerSecond.load(std::memory_order_relaxed);
+	if (Quota <= 0 || Level == ELoggerLevel::Fatal)
+	{
+		return true;
+	}
+
+	const FObjectKey Key = GetQuotaKey(Caller);
+	const uint32 Second = GetCurrentSecond();
+	const int32 LevelIndex = static_cast<int32>(Level);
+
+	FScopeLock ScopeLock(&Lock);
+	FSlot* Slot = FindSlot(Key, true);
+
+	// Reset the counts the first time the slot is touched in a new second.
+	if (Slot->Second != Second)
+	{
+		Slot->Second = Second;
+		FMemory::Memzero(Slot->Counts);
+	}
+
+	if (Slot->Counts[LevelIndex] >= Quota)
+	{
+		++Slot->Suppressed[LevelIndex];
+		return false;
+	}
+
+	++Slot->Counts[LevelIndex];
+	return true;
+}
+
+void FLoggerActorQuota::Tick()
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	// Called every frame, so suppressed counts keep accumulating until a second has passed.
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastReportTime < 1.0)
+	{
+		return;
+	}
+	LastReportTime = Now;
+
+	// Gather the lines under the lock and log them after it is released.
+	TArray<FString> Lines;
+	{
+		FScopeLock ScopeLock(&Lock);
+		for (FSlot& Slot : Slots)
+		{
+			uint32 Total = 0;
+			for (const uint32 Suppressed : Slot.Suppressed)
+			{
+				Total += Suppressed;
+			}
+			if (Total == 0)
+			{
+				continue;
+			}
+
+			const UObject* Actor = Slot.Key.ResolveObjectPtr();
+			FString Line = FString::Printf(TEXT("[Quota]\t%s: suppressed %u records ("), Actor ? *Actor->GetName() : TEXT("DestroyedActor"), Total);
+
+			bool bFirst = true;
+			for (int32 LevelIndex = NumLevels - 1; LevelIndex >= 0; --LevelIndex)
+			{
+				if (Slot.Suppressed[LevelIndex] > 0)
+				{
+					Line += FString::Printf(TEXT("%s%s: %u"), bFirst ? TEXT("") : TEXT(", "), *StaticEnum<ELoggerLevel>()->GetNameStringByValue(LevelIndex), Slot.Suppressed[LevelIndex]);
+					bFirst = false;
+				}
+			}
+			Line += TEXT(")");
+
+			Lines.Add(MoveTemp(Line));
+			FMemory::Memzero(Slot.Suppressed);
+		}
+	}
+
+	for (const FString& Line : Lines)
+	{
+		UE_LOG(LogLoggerLibrary, Display, TEXT("%s"), *Line);
+	}
+}
+
+FLoggerActorQuota::FSlot* FLoggerActorQuota::FindSlot(const FObjectKey& Key, bool bAdd)
+{
+	if (Slots.Num() == 0)
+	{
+		if (!bAdd)
+		{
+			return nullptr;
+		}
+		Slots.SetNum(MinCapacity);
+	}
+
+	// Keep the table at most half full so probes stay short.
+	if (bAdd && (NumUsed + 1) * 2 > Slots.Num())
+	{
+		Rehash();
+	}
+
+	const uint32 Mask = static_cast<uint32>(Slots.Num() - 1);
+	uint32 Index = GetTypeHash(Key) & Mask;
+	for (;;)
+	{
+		FSlot& Slot = Slots[Index];
+		if (Slot.Key == Key)
+		{
+			return &Slot;
+		}
+		if (Slot.Key == FObjectKey())
+		{
+			if (!bAdd)
+			{
+				return nullptr;
+			}
+			Slot.Key = Key;
+			++NumUsed;
+			return &Slot;
+		}
+		Index = (Index + 1) & Mask;
+	}
+}
+
+void FLoggerActorQuota::Rehash()
+{
+	// Slots that counted nothing this second and have nothing to report can be dropped.
+	const uint32 Second = GetCurrentSecond();
+	TArray<FSlot> Live;
+	for (const FSlot& Slot : Slots)
+	{
+		if (Slot.Key == FObjectKey())
+		{
+			continue;
+		}
+
+		bool bHasSuppressed = false;
+		for (const uint32 Suppressed : Slot.Suppressed)
+		{
+			bHasSuppressed |= Suppressed > 0;
+		}
+		if (Slot.Second == Second || bHasSuppressed)
+		{
+			Live.Add(Slot);
+		}
+	}
+
+	int32 Capacity = MinCapacity;
+	while (Capacity < (Live.Num() + 1) * 4)
+	{
+		Capacity *= 2;
+	}
+
+	Slots.Reset();
+	Slots.SetNum(Capacity);
+	NumUsed = 0;
+
+	const uint32 Mask = static_cast<uint32>(Capacity - 1);
+	for (const FSlot& Slot : Live)
+	{
+		uint32 Index = GetTypeHash(Slot.Key) & Mask;
+		while (Slots[Index].Key != FObjectKey())
+		{
+			Index = (Index + 1) & Mask;
+		}
+		Slots[Index] = Slot;
+		++NumUsed;
+	}
+}
+
+FObjectKey FLoggerActorQuota::GetQuotaKey(const UObject* Caller)
+{
+	if (const UActorComponent* Component = Cast<UActorComponent>(Caller))
+	{
+		if (const AActor* Owner = Component->GetOwner())
+		{
+			return FObjectKey(Owner);
+		}
+	}
+	return FObjectKey(Caller);
+}
+
+uint32 FLoggerActorQuota::GetCurrentSecond()
+{
+	// Offset by one so a zeroed slot never looks current.
+	return static_cast<uint32>(FPlatformTime::Seconds()) + 1;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file		LoggerActorQuota.h
+ * @brief		Limits the number of records each actor can log per second.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoggerLibrary.h"
+#include "UObject/ObjectKey.h"
+#include <atomic>
+
+/**
+ * @class FLoggerActorQuota
+ * @brief Lets each actor log at most a fixed number of records per second at each level.
+ *
+ * Components count against their owning actor, matching the context name of logged messages.
+ * Counts live in an open addressing table keyed by object, and a slot's counts are reset lazily
+ * the first time it is touched in a new second. Suppressed records are reported once per second
+ * in a summary line per actor.
+ */
+class FLoggerActorQuota
+{
+public:
+	/**
+	 * @brief Configures the quota.
+	 *
+	 * @param InRecordsPerSecond The number of records an actor can log per second at each level. Zero disables the quota.
+	 */
+	static void Configure(int32 InRecordsPerSecond);
+
+	/** @return True if the quota is enabled. */
+	static bool IsEnabled() { return RecordsPerSecond.load(std::memory_order_relaxed) > 0; }
+
+	/**
+	 * @brief Checks whether the caller's actor has used up its quota for a level, without using any of it.
+	 *
+	 * A record found over quota is counted as suppressed.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Level		Log level of the record.
+	 * @return True if the record is over quota.
+	 */
+	static bool IsOverQuota(const UObject* Caller, ELoggerLevel Level);
+
+	/**
+	 * @brief Uses one record of the quota of the caller's actor.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Level		Log level of the record.
+	 * @return True if the record is within the quota and should be emitted.
+	 */
+	static bool TryConsume(const UObject* Caller, ELoggerLevel Level);
+
+	/**
+	 * @brief Logs a summary line for every actor that had records suppressed since the last summary,
+	 * at most once per second.
+	 */
+	static void Tick();
+
+private:
+	/** The number of logger levels. */
+	static constexpr int32 NumLevels = static_cast<int32>(ELoggerLevel::Fatal) + 1;
+
+	/** The smallest number of slots in the table. Must be a power of two. */
+	static constexpr int32 MinCapacity = 256;
+
+	/**
+	 * @struct FSlot
+	 * @brief The counts of one actor.
+	 */
+	struct FSlot
+	{
+		/** The actor, or a null key if the slot is empty. */
+		FObjectKey Key;
+
+		/** The second the counts belong to. */
+		uint32 Second = 0;
+
+		/** The number of records logged this second, per level. */
+		uint16 Counts[NumLevels] = {};
+
+		/** The number of records suppressed since the last summary, per level. */
+		uint32 Suppressed[NumLevels] = {};
+	};
+
+	/**
+	 * @brief Finds the slot of a key. Must be called with the lock held.
+	 *
+	 * @param Key		The actor's key.
+	 * @param bAdd		Whether to claim a slot if the key has none.
+	 * @return The slot, or null if it does not exist and bAdd is false.
+	 */
+	static FSlot* FindSlot(const FObjectKey& Key, bool bAdd);
+
+	/**
+	 * @brief Rebuilds the table, dropping slots with nothing left to count or report. Must be called with the lock held.
+	 */
+	static void Rehash();
+
+	/** @return The key quotas are counted under for a caller. */
+	static FObjectKey GetQuotaKey(const UObject* Caller);
+
+	/** @return The current second. */
+	static uint32 GetCurrentSecond();
+
+	/** The number of records an actor can log per second at each level. */
+	inline static std::atomic<int32> RecordsPerSecond { 0 };
+
+	/** The slots. The number of slots is zero or a power of two. */
+	inline static TArray<FSlot> Slots;
+
+	/** The number of used slots. */
+	inline static int32 NumUsed = 0;
+
+	/** Guards the slots. */
+	inline static FCriticalSection Lock;
+
+	/** The platform time of the last summary, in seconds. Only touched by Tick, on the game thread. */
+	inline static double LastReportTime = 0.0;
+};
@@ -0,0 +1,196 @@
+/**
+ * @file		LoggerAllocationScope.cpp
+ * @brief		Counts the allocations a thread makes within a scope, for logger performance tests.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerAllocationScope.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/AutomationTest.h"
+
+#if GRONK_WITH_ALLOCATION_TRACKING
+
+/**
+ * @struct FThreadAllocationCounts
+ * @brief The allocations a thread made while it had a scope open.
+ */
+struct FThreadAllocationCounts
+{
+	/** The number of scopes the thread has open. Nothing is counted while zero. */
+	int32 Depth = 0;
+
+	uint64 Allocations = 0;
+	uint64 Bytes = 0;
+};
+
+/** The counts of the calling thread. Plain data, so reading it never allocates. */
+static thread_local FThreadAllocationCounts ThreadCounts;
+
+/**
+ * @class FLoggerCountingMalloc
+ * @brief Forwards to another allocator and counts the allocations of threads with a scope open.
+ */
+class FLoggerCountingMalloc final : public FMalloc
+{
+public:
+	explicit FLoggerCountingMalloc(FMalloc* InInner)
+		: Inner(InInner)
+	{
+	}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		Record(Count);
+		return Inner->Malloc(Count, Alignment);
+	}
+
+	virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+	{
+		Record(Count);
+		return Inner->TryMalloc(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+		{
+			Record(Count);
+		}
+		return Inner->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+		{
+			Record(Count);
+		}
+		return Inner->TryRealloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override { Inner->Free(Original); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+	virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+	virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+	virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+	virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+	virtual const TCHAR* GetDescriptiveName() override { return TEXT("LoggerCountingMalloc"); }
+
+private:
+	/**
+	 * @brief Counts an allocation if the calling thread has a scope open.
+	 *
+	 * @param Size The requested size of the allocation.
+	 */
+	static void Record(SIZE_T Size)
+	{
+		FThreadAllocationCounts& Counts = ThreadCounts;
+		if (Counts.Depth > 0)
+		{
+			++Counts.Allocations;
+			Counts.Bytes += Size;
+		}
+	}
+
+	FMalloc* Inner;
+};
+
+/**
+ * @brief Installs the counting proxy in front of GMalloc once.
+ *
+ * The proxy is never removed, since other threads may hold on to it. Blocks allocated before it
+ * was installed are freed through it, which is fine because it forwards everything.
+ */
+static void InstallCountingMalloc()
+{
+	static bool bInstalled = [] ()
+	{
+		static FLoggerCountingMalloc CountingMalloc(GMalloc);
+		GMalloc = &CountingMalloc;
+		return true;
+	}();
+	(void)bInstalled;
+}
+
+FLoggerAllocationScope::FLoggerAllocationScope()
+{
+	InstallCountingMalloc();
+
+	FThreadAllocationCounts& Counts = ThreadCounts;
+	++Counts.Depth;
+	StartAllocations = Counts.Allocations;
+	StartBytes = Counts.Bytes;
+}
+
+FLoggerAllocationScope::~FLoggerAllocationScope()
+{
+	--ThreadCounts.Depth;
+}
+
+uint64 FLoggerAllocationScope::GetNumAllocations() const
+{
+	return ThreadCounts.Allocations - StartAllocations;
+}
+
+uint64 FLoggerAllocationScope::GetNumBytes() const
+{
+	return ThreadCounts.Bytes - StartBytes;
+}
+
+bool FLoggerExpectNoAllocScope::Step()
+{
+	if (!bRan)
+	{
+		bRan = true;
+		return true;
+	}
+
+	const uint64 NumAllocations = Scope.GetNumAllocations();
+	if (NumAllocations > 0)
+	{
+		const FString Error = FString::Printf(TEXT("Expected no allocations at %s:%d, but made %llu totaling %llu bytes"), File, Line, NumAllocations, Scope.GetNumBytes());
+		if (FAutomationTestBase* CurrentTest = FAutomationTestFramework::Get().GetCurrentTest())
+		{
+			CurrentTest->AddError(Error);
+		}
+		else
+		{
+			ensureMsgf(false, TEXT("%s"), *Error);
+		}
+	}
+	return false;
+}
+
+#else
+
+FLoggerAllocationScope::FLoggerAllocationScope()
+{
+}
+
+FLoggerAllocationScope::~FLoggerAllocationScope()
+{
+}
+
+uint64 FLoggerAllocationScope::GetNumAllocations() const
+{
+	return 0;
+}
+
+uint64 FLoggerAllocationScope::GetNumBytes() const
+{
+	return 0;
+}
+
+bool FLoggerExpectNoAllocScope::Step()
+{
+	const bool bShouldRun = !bRan;
+	bRan = true;
+	return bShouldRun;
+}
+
+#endif
@@ -0,0 +1,345 @@
+/**
+ * @file		LoggerBuiltinSinks.cpp
+ * @brief		The sinks behind the built‑in outputs of the logger library.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerBuiltinSinks.h"
+#include "Engine/Engine.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "LoggerEscalation.h"
+#include "LoggerLog.h"
+#include "LoggerSessionStats.h"
+#include "Misc/App.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+#if PLATFORM_UNIX || PLATFORM_MAC
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#else
+#include "HAL/PlatformFileManager.h"
+#endif
+
+static float FileFlushInterval = 0.5f;
+static FAutoConsoleVariableRef CVarFileFlushInterval(
+	TEXT("gronk.log.File.FlushInterval"),
+	FileFlushInterval,
+	TEXT("The maximum number of seconds records wait in a file sink before they are written."));
+
+static int32 FileFlushBytes = 256 * 1024;
+static FAutoConsoleVariableRef CVarFileFlushBytes(
+	TEXT("gronk.log.File.FlushBytes"),
+	FileFlushBytes,
+	TEXT("The number of pending bytes at which a file sink writes its records immediately."));
+
+static FAutoConsoleCommand CmdFileStats(
+	TEXT("gronk.log.File.Stats"),
+	TEXT("Logs the write system calls made by the file sinks, per second since the last call and in total."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		static double LastTime = FPlatformTime::Seconds();
+		static FLoggerFileWriteStats LastStats;
+
+		const double Now = FPlatformTime::Seconds();
+		const FLoggerFileWriteStats Stats = FLoggerFileSink::GetWriteStats();
+		const double Elapsed = FMath::Max(Now - LastTime, UE_DOUBLE_SMALL_NUMBER);
+
+		UE_LOG(LogLoggerLibrary, Display, TEXT("[FileSinks]\tsyscalls/s= %.1f records/s= %.1f records/syscall= %.1f total syscalls= %llu records= %llu bytes= %llu"),
+			(Stats.Syscalls - LastStats.Syscalls) / Elapsed,
+			(Stats.Records - LastStats.Records) / Elapsed,
+			Stats.Syscalls > 0 ? static_cast<double>(Stats.Records) / Stats.Syscalls : 0.0,
+			Stats.Syscalls, Stats.Records, Stats.Bytes);
+
+		LastTime = Now;
+		LastStats = Stats;
+	}));
+
+// The most buffers handed to a single writev call.
+#if PLATFORM_UNIX || PLATFORM_MAC
+static constexpr int32 FileMaxVectors = IOV_MAX < 1024 ? IOV_MAX : 1024;
+#endif
+
+// The totals of the writes made by every file sink.
+static std::atomic<uint64> TotalSyscalls { 0 };
+static std::atomic<uint64> TotalRecords { 0 };
+static std::atomic<uint64> TotalBytes { 0 };
+
+// A static map to associate log levels with on‑screen colors.
+static const TMap<ELoggerLevel, FColor> LevelColorMap = {
+	{ ELoggerLevel::VeryVerbose, FColor::Purple },
+	{ ELoggerLevel::Verbose, FColor::Blue },
+	{ ELoggerLevel::Log, FColor::White },
+	{ ELoggerLevel::Display, FColor::Cyan },
+	{ ELoggerLevel::Warning, FColor::Yellow },
+	{ ELoggerLevel::Error, FColor::Red },
+	{ ELoggerLevel::Fatal, FColor::Magenta }
+};
+
+void FLoggerOutputLogSink::Write(const FLoggerRecord& Record, const FLoggerFormattedRecord& Formatted)
+{
+	const FString& LogString = *Formatted.Text;
+
+	// Records let through by an escalation are written at Log so the output log does not drop them.
+	// The level is still in the prefix, so nothing about the record is lost.
+	ELoggerLevel OutputLevel = Record.Level;
+	if (LogLoggerLibrary.IsSuppressed(ToLogVerbosity(Record.Level)) && FLoggerEscalation::IsEscalated(Record.Caller, Record.Level))
+	{
+		OutputLevel = ELoggerLevel::Log;
+	}
+
+	switch (OutputLevel)
+	{
+		case ELoggerLevel::VeryVerbose:
+			UE_LOG(LogLoggerLibrary, VeryVerbose, TEXT("%s"), *LogString);
+			break;
+		case ELoggerLevel::Verbose:
+			UE_LOG(LogLoggerLibrary, Verbose, TEXT("%s"), *LogString);
+			break;
+		case ELoggerLevel::Log:
+			UE_LOG(LogLoggerLibrary, Log, TEXT("%s"), *LogString);
+			break;
+		case ELoggerLevel::Display:
+			UE_LOG(LogLoggerLibrary, Display, TEXT("%s"), *LogString);
+			break;
+		case ELoggerLevel::Warning:
+			UE_LOG(LogLoggerLibrary, Warning, TEXT("%s"), *LogString);
+			break;
+		case ELoggerLevel::Error:
+			UE_LOG(LogLoggerLibrary, Error, TEXT("%s"), *LogString);
+			break;
+		case ELoggerLevel::Fatal:
+			UE_LOG(LogLoggerLibrary, Fatal, TEXT("%s"), *LogString);
+			break;
+		default:
+			UE_LOG(LogLoggerLibrary, Log, TEXT("%s"), *LogString);
+			break;
+	}
+}
+
+void FLoggerOnScreenSink::Write(const FLoggerRecord& Record, const FLoggerFormattedRecord& Formatted)
+{
+	if (static_cast<uint8>(Record.Level) >= static_cast<uint8>(ULoggerLibrary::GetDisplayLogLevel()))
+	{
+		if (GEngine)
+		{
+			FColor TextColor = GetColorForLevel(Record.Level);
+			GEngine->AddOnScreenDebugMessage(-1, 5.f, TextColor, *Formatted.Text);
+			FLoggerSessionStats::RecordOnScreen();
+		}
+	}
+}
+
+FColor FLoggerOnScreenSink::GetColorForLevel(ELoggerLevel Level)
+{
+	if (const FColor* FoundColor = LevelColorMap.Find(Level))
+	{
+		return *FoundColor;
+	}
+	return FColor::White;
+}
+
+FLoggerFileSink::FLoggerFileSink(ELoggerRepresentation InRepresentation, const TCHAR* InExtension)
+	: Representation(InRepresentation)
+{
+	const FString FileName = FString::Printf(TEXT("%s-%s.%s"), FApp::GetProjectName(), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")), InExtension);
+	FilePath = FPaths::Combine(FPaths::ProjectLogDir(), TEXT("GronkUtils"), FileName);
+}
+
+FLoggerFileSink::~FLoggerFileSink()
+{
+	FScopeLock ScopeLock(&Lock);
+	WritePending();
+	CloseFile();
+}
+
+void FLoggerFileSink::Write(const FLoggerRecord& Record, const FLoggerFormattedRecord& Formatted)
+{
+	const TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe>& Bytes = Representation == ELoggerRepresentation::JsonLine ? Formatted.JsonLine : Formatted.Utf8Line;
+	if (!Bytes.IsValid())
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	Pending.Add(Bytes.ToSharedRef());
+	PendingBytes += Bytes->Num();
+
+	if (PendingBytes >= FileFlushBytes)
+	{
+		WritePending();
+	}
+}
+
+void FLoggerFileSink::Tick(float DeltaTime)
+{
+	FScopeLock ScopeLock(&Lock);
+	TimeSinceWrite += DeltaTime;
+	if (TimeSinceWrite >= FileFlushInterval)
+	{
+		WritePending();
+	}
+}
+
+void FLoggerFileSink::Flush()
+{
+	FScopeLock ScopeLock(&Lock);
+	WritePending();
+}
+
+FLoggerFileWriteStats FLoggerFileSink::GetWriteStats()
+{
+	FLoggerFileWriteStats Stats;
+	Stats.Syscalls = TotalSyscalls.load(std::memory_order_relaxed);
+	Stats.Records = TotalRecords.load(std::memory_order_relaxed);
+	Stats.Bytes = TotalBytes.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+void FLoggerFileSink::WritePending()
+{
+	TimeSinceWrite = 0.f;
+	if (Pending.Num() == 0)
+	{
+		return;
+	}
+
+	if (!OpenFile())
+	{
+		for (int32 Index = 0; Index < Pending.Num(); ++Index)
+		{
+			FLoggerSessionStats::RecordDrop();
+		}
+		Pending.Reset();
+		PendingBytes = 0;
+		return;
+	}
+
+	uint64 Syscalls = 0;
+	uint64 BytesWritten = 0;
+	int32 NumWritten = Pending.Num();
+
+#if PLATFORM_UNIX || PLATFORM_MAC
+	// Hand the kernel up to IOV_MAX buffers per call, resuming mid buffer after a short write.
+	int32 First = 0;
+	int64 FirstOffset = 0;
+	while (First < Pending.Num())
+	{
+		iovec Vectors[FileMaxVectors];
+		int32 NumVectors = 0;
+		for (int32 Index = First; Index < Pending.Num() && NumVectors < FileMaxVectors; ++Index, ++NumVectors)
+		{
+			const int64 Offset = Index == First ? FirstOffset : 0;
+			Vectors[NumVectors].iov_base = const_cast<uint8*>(Pending[Index]->GetData()) + Offset;
+			Vectors[NumVectors].iov_len = static_cast<size_t>(Pending[Index]->Num() - Offset);
+		}
+
+		const ssize_t Written = writev(FileDescriptor, Vectors, NumVectors);
+		++Syscalls;
+		if (Written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			// Give up on the rest of the batch rather than retrying a failing file every record.
+			for (int32 Index = First; Index < Pending.Num(); ++Index)
+			{
+				FLoggerSessionStats::RecordDrop();
+			}
+			NumWritten = First;
+			break;
+		}
+
+		BytesWritten += Written;
+		int64 Remaining = Written;
+		while (Remaining > 0)
+		{
+			const int64 BufferRemaining = Pending[First]->Num() - FirstOffset;
+			if (Remaining >= BufferRemaining)
+			{
+				Remaining -= BufferRemaining;
+				FirstOffset = 0;
+				++First;
+			}
+			else
+			{
+				FirstOffset += Remaining;
+				Remaining = 0;
+			}
+		}
+	}
+#else
+	GatherBuffer.Reset(PendingBytes);
+	for (const FLoggerSharedBytes& Bytes : Pending)
+	{
+		GatherBuffer.Append(*Bytes);
+	}
+
+	++Syscalls;
+	if (!FileHandle->Write(GatherBuffer.GetData(), GatherBuffer.Num()))
+	{
+		for (int32 Index = 0; Index < Pending.Num(); ++Index)
+		{
+			FLoggerSessionStats::RecordDrop();
+		}
+		NumWritten = 0;
+	}
+	else
+	{
+		BytesWritten = GatherBuffer.Num();
+	}
+#endif
+
+	TotalSyscalls.fetch_add(Syscalls, std::memory_order_relaxed);
+	TotalRecords.fetch_add(NumWritten, std::memory_order_relaxed);
+	TotalBytes.fetch_add(BytesWritten, std::memory_order_relaxed);
+
+	Pending.Reset();
+	PendingBytes = 0;
+}
+
+bool FLoggerFileSink::OpenFile()
+{
+#if PLATFORM_UNIX || PLATFORM_MAC
+	if (FileDescriptor >= 0)
+	{
+		return true;
+	}
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+	const FString AbsolutePath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*FilePath);
+	FileDescriptor = open(TCHAR_TO_UTF8(*AbsolutePath), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	return FileDescriptor >= 0;
+#else
+	if (FileHandle)
+	{
+		return true;
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+	FileHandle.Reset(PlatformFile.OpenWrite(*FilePath, true, true));
+	return FileHandle.IsValid();
+#endif
+}
+
+void FLoggerFileSink::CloseFile()
+{
+#if PLATFORM_UNIX || PLATFORM_MAC
+	if (FileDescriptor >= 0)
+	{
+		close(FileDescriptor);
+		FileDescriptor = -1;
+	}
+#else
+	FileHandle.Reset();
+#endif
+}
@@ -0,0 +1,132 @@
+/**
+ * @file		LoggerBuiltinSinks.h
+ * @brief		The sinks behind the built‑in outputs of the logger library.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "LoggerSink.h"
+
+/**
+ * @class FLoggerOutputLogSink
+ * @brief Writes records to the output log under LogLoggerLibrary.
+ */
+class FLoggerOutputLogSink : public ILoggerSink
+{
+public:
+	virtual ELoggerRepresentation GetRepresentations() const override { return ELoggerRepresentation::Text; }
+	virtual void Write(const FLoggerRecord& Record, const FLoggerFormattedRecord& Formatted) override;
+};
+
+/**
+ * @class FLoggerOnScreenSink
+ * @brief Shows records at or above the display level on screen.
+ */
+class FLoggerOnScreenSink : public ILoggerSink
+{
+public:
+	virtual ELoggerRepresentation GetRepresentations() const override { return ELoggerRepresentation::Text; }
+	virtual void Write(const FLoggerRecord& Record, const FLoggerFormattedRecord& Formatted) override;
+
+	/**
+	 * @brief Gets an on‑screen text color for the given log level.
+	 *
+	 * @param Level The logging level.
+	 * @return The FColor to use for on‑screen text.
+	 */
+	static FColor GetColorForLevel(ELoggerLevel Level);
+};
+
+/**
+ * @struct FLoggerFileWriteStats
+ * @brief Totals of the writes made by every file sink.
+ */
+struct FLoggerFileWriteStats
+{
+	/** The number of write system calls made. */
+	uint64 Syscalls = 0;
+
+	/** The number of records written. */
+	uint64 Records = 0;
+
+	/** The number of bytes written. */
+	uint64 Bytes = 0;
+};
+
+/**
+ * @class FLoggerFileSink
+ * @brief Appends one UTF‑8 representation of each record to a file in Saved/Logs/GronkUtils.
+ *
+ * Records are not copied. The sink keeps references to their shared buffers and writes a whole
+ * batch at once when it reaches "gronk.log.File.FlushBytes" or "gronk.log.File.FlushInterval"
+ * elapses. On POSIX platforms a batch goes out through writev, many buffers per system call.
+ * Elsewhere it is gathered into one contiguous buffer and written with a single call.
+ */
+class FLoggerFileSink : public ILoggerSink
+{
+public:
+	/**
+	 * @param InRepresentation	The representation to write. Must be Utf8Line or JsonLine.
+	 * @param InExtension		The extension of the file, without the dot.
+	 */
+	FLoggerFileSink(ELoggerRepresentation InRepresentation, const TCHAR* InExtension);
+	virtual ~FLoggerFileSink() override;
+
+	virtual ELoggerRepresentation GetRepresentations() const override { return Representation; }
+	virtual void Write(const FLoggerRecord& Record, const FLoggerFormattedRecord& Formatted) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual void Flush() override;
+
+	/** @return The totals of the writes made by every file sink so far. */
+	static FLoggerFileWriteStats GetWriteStats();
+
+private:
+	/**
+	 * @brief Writes every pending buffer to the file. Must be called with the lock held.
+	 */
+	void WritePending();
+
+	/**
+	 * @brief Opens the file if it is not open yet. Must be called with the lock held.
+	 *
+	 * @return True if the file is open.
+	 */
+	bool OpenFile();
+
+	/**
+	 * @brief Closes the file. Must be called with the lock held.
+	 */
+	void CloseFile();
+
+	/** The representation written to the file. */
+	ELoggerRepresentation Representation;
+
+	/** The path of the file. */
+	FString FilePath;
+
+#if PLATFORM_UNIX || PLATFORM_MAC
+	/** The descriptor of the file, or -1 until the first batch is written. */
+	int FileDescriptor = -1;
+#else
+	/** The handle of the file, opened when the first batch is written. */
+	TUniquePtr<IFileHandle> FileHandle;
+
+	/** The buffer a batch is gathered into before it is written. */
+	TArray<uint8> GatherBuffer;
+#endif
+
+	/** The buffers waiting to be written. */
+	TArray<FLoggerSharedBytes> Pending;
+
+	/** The total size of the pending buffers. */
+	int64 PendingBytes = 0;
+
+	/** The number of seconds since the last batch was written. */
+	float TimeSinceWrite = 0.f;
+
+	/** Guards the file and the pending buffers. */
+	FCriticalSection Lock;
+};
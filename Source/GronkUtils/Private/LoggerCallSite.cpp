@@ -0,0 +1,41 @@
+/**
+ * @file		LoggerCallSite.cpp
+ * @brief		Identifies the Blueprint call site of a logging function.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerCallSite.h"
+#include "UObject/Script.h"
+#include "UObject/Stack.h"
+
+FLoggerCallSite FLoggerCallSite::GetCurrent()
+{
+	FLoggerCallSite CallSite;
+
+#if DO_BLUEPRINT_GUARD
+	// Native functions run inside their caller's frame, so the top frame is the calling Blueprint.
+	// By the time the function body runs, its parameters are consumed and Code is unique to the call.
+	TArrayView<const FFrame* const> ScriptStack = FBlueprintContextTracking::Get().GetCurrentScriptStack();
+	if (ScriptStack.Num() > 0)
+	{
+		const FFrame* Frame = ScriptStack.Last();
+		if (Frame && Frame->Node && Frame->Code)
+		{
+			CallSite.Function = Frame->Node;
+			CallSite.CodeOffset = static_cast<int32>(Frame->Code - Frame->Node->Script.GetData());
+		}
+	}
+#endif
+
+	return CallSite;
+}
+
+FString FLoggerCallSite::ToString() const
+{
+	const UFunction* ResolvedFunction = Function.Get();
+	if (!IsValid() || !ResolvedFunction)
+	{
+		return TEXT("NativeOrUnknownCallSite");
+	}
+	return FString::Printf(TEXT("%s+%d"), *ResolvedFunction->GetPathName(), CodeOffset);
+}
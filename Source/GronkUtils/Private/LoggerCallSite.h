@@ -0,0 +1,45 @@
+/**
+ * @file		LoggerCallSite.h
+ * @brief		Identifies the Blueprint call site of a logging function.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+/**
+ * @struct FLoggerCallSite
+ * @brief The script function and bytecode offset a logging function was called from.
+ *
+ * Only available in builds with Blueprint script stack tracking. Elsewhere every call site is
+ * invalid and features keyed by call site fall back to their caller.
+ */
+struct FLoggerCallSite
+{
+	/** The script function containing the call. */
+	TWeakObjectPtr<const UFunction> Function;
+
+	/** The offset of the call in the function's bytecode. */
+	int32 CodeOffset = INDEX_NONE;
+
+	/** @return The call site of the Blueprint currently calling into native code. */
+	static FLoggerCallSite GetCurrent();
+
+	/** @return True if the call site was resolved. */
+	bool IsValid() const { return CodeOffset != INDEX_NONE; }
+
+	/** @return A readable description of the call site. */
+	FString ToString() const;
+
+	bool operator==(const FLoggerCallSite& Other) const
+	{
+		return CodeOffset == Other.CodeOffset && Function == Other.Function;
+	}
+
+	friend uint32 GetTypeHash(const FLoggerCallSite& CallSite)
+	{
+		return HashCombine(GetTypeHash(CallSite.Function), ::GetTypeHash(CallSite.CodeOffset));
+	}
+};
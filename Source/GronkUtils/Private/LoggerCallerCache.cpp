@@ -0,0 +1,73 @@
+/**
+ * @file		LoggerCallerCache.cpp
+ * @brief		Per‑caller state the logger derives once and reuses for every record.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerCallerCache.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "LoggerNetFilter.h"
+#include "LoggerPerThread.h"
+#include "LoggerUtf8.h"
+
+const FString& FLoggerCallerEntry::GetPrefix(ELoggerLevel Level)
+{
+	FString& Prefix = Prefixes[FMath::Min(static_cast<int32>(Level), NumLevels - 1)];
+	if (Prefix.IsEmpty())
+	{
+		Prefix = FString::Printf(TEXT("[%s]\t%s: "), *UEnum::GetValueAsString(Level), *ContextName);
+	}
+	return Prefix;
+}
+
+const TArray<uint8>& FLoggerCallerEntry::GetUtf8Prefix(ELoggerLevel Level)
+{
+	TArray<uint8>& Utf8Prefix = Utf8Prefixes[FMath::Min(static_cast<int32>(Level), NumLevels - 1)];
+	if (Utf8Prefix.Num() == 0)
+	{
+		const FString& Prefix = GetPrefix(Level);
+		FLoggerUtf8::Append(Utf8Prefix, *Prefix, Prefix.Len());
+	}
+	return Utf8Prefix;
+}
+
+FString FLoggerCallerCache::ResolveContextName(const UObject* Caller, const UObject*& OutOwner)
+{
+	OutOwner = nullptr;
+
+	// Determine the context name based on whether the caller is a component
+	if (const UActorComponent* Component = Cast<UActorComponent>(Caller))
+	{
+		if (const AActor* Owner = Component->GetOwner())
+		{
+			OutOwner = Owner;
+			return FString::Printf(TEXT("%s.%s"), *Owner->GetName(), *Component->GetName());
+		}
+		return Component->GetName();
+	}
+	return Caller ? Caller->GetName() : TEXT("UnknownContext");
+}
+
+FLoggerCallerCache::FThreadCache& FLoggerCallerCache::GetThreadCache()
+{
+	// Only the owning thread touches its entries, so the slot's lock is not needed.
+	return TLoggerPerThread<FThreadCache>::GetLocal();
+}
+
+FLoggerCallerEntry& FLoggerCallerCache::FindOrAddEntry(FThreadCache& ThreadCache, const UObject* Caller)
+{
+	const UActorComponent* Component = Cast<UActorComponent>(Caller);
+	const UObject* CurrentOwner = Component ? Component->GetOwner() : nullptr;
+
+	TUniquePtr<FLoggerCallerEntry>& Entry = ThreadCache.Entries.FindOrAdd(FObjectKey(Caller));
+	if (Entry && Entry->Owner == CurrentOwner)
+	{
+		return *Entry;
+	}
+
+	Entry = MakeUnique<FLoggerCallerEntry>();
+	Entry->ContextName = ResolveContextName(Caller, Entry->Owner);
+	FLoggerNetFilter::ResolveNetContext(Caller, *Entry);
+	return *Entry;
+}
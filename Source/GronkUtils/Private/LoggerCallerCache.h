@@ -0,0 +1,140 @@
+/**
+ * @file		LoggerCallerCache.h
+ * @brief		Per‑caller state the logger derives once and reuses for every record.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoggerLibrary.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * @struct FLoggerCallerEntry
+ * @brief What the logger knows about one caller.
+ */
+struct FLoggerCallerEntry
+{
+	/** The number of logger levels. */
+	static constexpr int32 NumLevels = static_cast<int32>(ELoggerLevel::Fatal) + 1;
+
+	/** The resolved name of the caller, e.g. "Owner.Component". */
+	FString ContextName;
+
+	/** The owner the context name was resolved with, to notice a component moving to another actor. */
+	const UObject* Owner = nullptr;
+
+	/** The net mode of the caller when the entry was created. */
+	ELoggerNetMode NetMode = ELoggerNetMode::Standalone;
+
+	/** The local role of the caller, or of the actor it belongs to, when the entry was created. */
+	ELoggerNetRole NetRole = ELoggerNetRole::NoActor;
+
+	/** The net mode as shown in records, e.g. "Server" or "Client 2". */
+	FString NetLabel;
+
+	/** The net filter generation the cached decision was made under. Zero if never decided. */
+	uint32 NetFilterGeneration = 0;
+
+	/** Whether the caller passed the net filters of that generation. */
+	bool bPassesNetFilter = true;
+
+	/** "[Level]\tContext: " for each level, built the first time the caller logs at the level. */
+	FString Prefixes[NumLevels];
+
+	/** The prefixes as UTF‑8. */
+	TArray<uint8> Utf8Prefixes[NumLevels];
+
+	/**
+	 * @brief Gets the prefix of a level, building it on first use.
+	 *
+	 * @param Level The logging level.
+	 * @return The prefix.
+	 */
+	const FString& GetPrefix(ELoggerLevel Level);
+
+	/**
+	 * @brief Gets the UTF‑8 prefix of a level, building it on first use.
+	 *
+	 * @param Level The logging level.
+	 * @return The UTF‑8 prefix.
+	 */
+	const TArray<uint8>& GetUtf8Prefix(ELoggerLevel Level);
+};
+
+/**
+ * @class FLoggerCallerCache
+ * @brief Keeps an entry per caller, so names and prefixes are not formatted on every record.
+ *
+ * Each thread has its own entries, so lookups take no locks. Entries are keyed by object index
+ * and serial number, which a new object never reuses. A thread's entries are dropped once there
+ * are too many of them, which only costs rebuilding the ones still in use.
+ */
+class FLoggerCallerCache
+{
+public:
+	/**
+	 * @brief Runs a function on the calling thread's entry for a caller.
+	 *
+	 * The entry is only valid for the duration of the function.
+	 *
+	 * @param Caller	The calling object. May be null.
+	 * @param Func		The function to run, taking an FLoggerCallerEntry&.
+	 */
+	template <typename FuncType>
+	static void Access(const UObject* Caller, FuncType&& Func)
+	{
+		FThreadCache& ThreadCache = GetThreadCache();
+
+		// Entries may only be dropped when no outer call on this thread is still using one.
+		if (ThreadCache.Depth == 0 && ThreadCache.Entries.Num() >= MaxEntriesPerThread)
+		{
+			ThreadCache.Entries.Reset();
+		}
+
+		FLoggerCallerEntry& Entry = FindOrAddEntry(ThreadCache, Caller);
+
+		++ThreadCache.Depth;
+		Func(Entry);
+		--ThreadCache.Depth;
+	}
+
+	/**
+	 * @brief Resolves the context name of a caller.
+	 *
+	 * @param Caller	The calling object. May be null.
+	 * @param OutOwner	The owner the name was resolved with.
+	 * @return The context name.
+	 */
+	static FString ResolveContextName(const UObject* Caller, const UObject*& OutOwner);
+
+private:
+	/** The number of entries a thread keeps before dropping them all. */
+	static constexpr int32 MaxEntriesPerThread = 1024;
+
+	/**
+	 * @struct FThreadCache
+	 * @brief The entries of one thread.
+	 */
+	struct FThreadCache
+	{
+		/** Entries are boxed so their addresses survive the map growing during a nested log. */
+		TMap<FObjectKey, TUniquePtr<FLoggerCallerEntry>> Entries;
+
+		/** The number of calls to Access in progress on the thread. */
+		int32 Depth = 0;
+	};
+
+	/** @return The calling thread's entries. */
+	static FThreadCache& GetThreadCache();
+
+	/**
+	 * @brief Finds the entry of a caller, creating or refreshing it as needed.
+	 *
+	 * @param ThreadCache	The calling thread's entries.
+	 * @param Caller		The calling object.
+	 * @return The entry.
+	 */
+	static FLoggerCallerEntry& FindOrAddEntry(FThreadCache& ThreadCache, const UObject* Caller);
+};
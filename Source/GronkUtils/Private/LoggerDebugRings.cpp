@@ -0,0 +1,116 @@
+/**
+ * @file		LoggerDebugRings.cpp
+ * @brief		Keeps the recent records of each actor for the Gameplay Debugger.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerDebugRings.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+static int32 DebugRingSize = 20;
+static FAutoConsoleVariableRef CVarDebugRingSize(
+	TEXT("gronk.log.Debugger.RingSize"),
+	DebugRingSize,
+	TEXT("The number of recent records kept per actor for the GronkLog Gameplay Debugger category."));
+
+// The number of rings at which rings of destroyed actors are dropped.
+static constexpr int32 PruneThreshold = 256;
+
+void FLoggerDebugRingSink::Acquire()
+{
+	FScopeLock ScopeLock(&InstanceLock);
+	if (NumHolders++ == 0)
+	{
+		Instance = MakeShared<FLoggerDebugRingSink, ESPMode::ThreadSafe>();
+		FLoggerSinks::AddSink(Instance.ToSharedRef());
+	}
+}
+
+void FLoggerDebugRingSink::Release()
+{
+	FScopeLock ScopeLock(&InstanceLock);
+	if (NumHolders > 0 && --NumHolders == 0)
+	{
+		FLoggerSinks::RemoveSink(Instance.ToSharedRef());
+		Instance.Reset();
+	}
+}
+
+void FLoggerDebugRingSink::GetRecords(const AActor* Actor, TArray<FLoggerDebugRecord>& OutRecords)
+{
+	OutRecords.Reset();
+
+	TSharedPtr<FLoggerDebugRingSink, ESPMode::ThreadSafe> Sink;
+	{
+		FScopeLock ScopeLock(&InstanceLock);
+		Sink = Instance;
+	}
+	if (!Sink || !Actor)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Sink->Lock);
+	if (const FRing* Ring = Sink->Rings.Find(FObjectKey(Actor)))
+	{
+		// Once full, the oldest record is the one about to be overwritten.
+		OutRecords.Reserve(Ring->Records.Num());
+		for (int32 Offset = 0; Offset < Ring->Records.Num(); ++Offset)
+		{
+			OutRecords.Add(Ring->Records[(Ring->Next + Offset) % Ring->Records.Num()]);
+		}
+	}
+}
+
+void FLoggerDebugRingSink::Write(const FLoggerRecord& Record, const FLoggerFormattedRecord& Formatted)
+{
+	const AActor* Actor = Cast<AActor>(Record.Caller);
+	if (const UActorComponent* Component = Cast<UActorComponent>(Record.Caller))
+	{
+		Actor = Component->GetOwner();
+	}
+	if (!Actor)
+	{
+		return;
+	}
+
+	const int32 RingSize = FMath::Max(DebugRingSize, 1);
+
+	FScopeLock ScopeLock(&Lock);
+	if (Rings.Num() >= PruneThreshold)
+	{
+		PruneRings();
+	}
+
+	FRing& Ring = Rings.FindOrAdd(FObjectKey(Actor));
+	FLoggerDebugRecord* Slot;
+	if (Ring.Records.Num() < RingSize)
+	{
+		Slot = &Ring.Records.AddDefaulted_GetRef();
+	}
+	else
+	{
+		Slot = &Ring.Records[Ring.Next % Ring.Records.Num()];
+		Ring.Next = (Ring.Next + 1) % Ring.Records.Num();
+	}
+
+	Slot->Time = FPlatformTime::Seconds();
+	Slot->Level = Record.Level;
+	Slot->ContextName = Record.ContextName;
+	Slot->Message = Record.Message;
+}
+
+void FLoggerDebugRingSink::PruneRings()
+{
+	for (auto It = Rings.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,94 @@
+/**
+ * @file		LoggerDebugRings.h
+ * @brief		Keeps the recent records of each actor for the Gameplay Debugger.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoggerSink.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * @struct FLoggerDebugRecord
+ * @brief An unformatted record kept for an actor.
+ */
+struct FLoggerDebugRecord
+{
+	/** The platform time the record was emitted, in seconds. */
+	double Time = 0.0;
+
+	ELoggerLevel Level = ELoggerLevel::Display;
+
+	/** The resolved name of the caller, which may be a component of the actor. */
+	FString ContextName;
+
+	FString Message;
+};
+
+/**
+ * @class FLoggerDebugRingSink
+ * @brief A sink that keeps the last records of every actor that logs, while anything is watching.
+ *
+ * The sink is only registered while at least one Gameplay Debugger category holds it, so outside
+ * of debugging nothing is kept. Rings are allocated for an actor the first time it logs, and keep
+ * records unformatted until one actor's records are asked for.
+ */
+class FLoggerDebugRingSink : public ILoggerSink
+{
+public:
+	/**
+	 * @brief Starts keeping records, if nothing else already holds the sink.
+	 */
+	static void Acquire();
+
+	/**
+	 * @brief Stops keeping records and frees every ring, once nothing holds the sink.
+	 */
+	static void Release();
+
+	/**
+	 * @brief Gets the kept records of an actor.
+	 *
+	 * @param Actor			The actor.
+	 * @param OutRecords	The records, oldest first.
+	 */
+	static void GetRecords(const AActor* Actor, TArray<FLoggerDebugRecord>& OutRecords);
+
+	virtual ELoggerRepresentation GetRepresentations() const override { return ELoggerRepresentation::None; }
+	virtual void Write(const FLoggerRecord& Record, const FLoggerFormattedRecord& Formatted) override;
+
+private:
+	/**
+	 * @struct FRing
+	 * @brief The last records of one actor.
+	 */
+	struct FRing
+	{
+		TArray<FLoggerDebugRecord> Records;
+
+		/** The index the next record is written to once the ring is full. */
+		int32 Next = 0;
+	};
+
+	/**
+	 * @brief Drops the rings of actors that no longer exist. Must be called with the lock held.
+	 */
+	void PruneRings();
+
+	/** The ring of each actor that logged. */
+	TMap<FObjectKey, FRing> Rings;
+
+	/** Guards the rings. */
+	FCriticalSection Lock;
+
+	/** The registered sink, while held. */
+	inline static TSharedPtr<FLoggerDebugRingSink, ESPMode::ThreadSafe> Instance;
+
+	/** The number of holders of the sink. */
+	inline static int32 NumHolders = 0;
+
+	/** Guards the instance and its holders. */
+	inline static FCriticalSection InstanceLock;
+};
@@ -0,0 +1,232 @@
+/**
+ * @file		LoggerDownsample.cpp
+ * @brief		Online Largest‑Triangle‑Three‑Buckets downsampling of logged numeric series.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerDownsample.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "LoggerCallerCache.h"
+#include "LoggerPerThread.h"
+
+static int32 DownsampleMaxSeries = 1024;
+static FAutoConsoleVariableRef CVarDownsampleMaxSeries(
+	TEXT("gronk.log.Downsample.MaxSeries"),
+	DownsampleMaxSeries,
+	TEXT("The most series each thread downsamples at once. Values of further series are logged unreduced."));
+
+// The series of one thread.
+using FLoggerThreadSeries = TMap<FLoggerSeriesKey, FLoggerSeries>;
+
+/**
+ * @brief Gets twice the area of a triangle.
+ *
+ * @return The doubled area, which ranks triangles the same as their area.
+ */
+static double GetDoubledArea(double AX, double AY, double BX, double BY, double CX, double CY)
+{
+	return FMath::Abs((AX - CX) * (BY - AY) - (AX - BX) * (CY - AY));
+}
+
+void FLoggerDownsample::Configure(bool bInEnabled, int32 InWindowSize, int32 InPointsPerWindow, float InFlushInterval)
+{
+	if (bEnabled)
+	{
+		Flush();
+	}
+
+	WindowSize = FMath::Max(InWindowSize, 3);
+	PointsPerWindow = FMath::Clamp(InPointsPerWindow, 1, WindowSize);
+	FlushInterval = FMath::Max(InFlushInterval, 0.f);
+	bEnabled = bInEnabled;
+}
+
+bool FLoggerDownsample::Add(UObject* Caller, const FString& Message, double Value, ELoggerLevel Level, bool bIsInt)
+{
+	FLoggerSeriesKey Key{ FLoggerCallSite::GetCurrent(), FObjectKey(Caller) };
+	if (!Key.CallSite.IsValid())
+	{
+		Key.Message = Message;
+	}
+
+	bool bTracked = false;
+	TLoggerPerThread<FLoggerThreadSeries>::Modify([&](FLoggerThreadSeries& AllSeries)
+	{
+		FLoggerSeries* Series = AllSeries.Find(Key);
+		if (!Series)
+		{
+			if (AllSeries.Num() >= DownsampleMaxSeries)
+			{
+				return;
+			}
+			Series = &AllSeries.Add(Key);
+			Series->Caller = Caller;
+			Series->bHasCaller = Caller != nullptr;
+			Series->Window.Reserve(WindowSize);
+
+			if (Series->bHasCaller)
+			{
+				FLoggerCallerCache::Access(Caller, [Series](FLoggerCallerEntry& Entry)
+				{
+					Series->ContextName = Entry.ContextName;
+					Series->NetLabel = Entry.NetLabel;
+				});
+			}
+		}
+
+		bTracked = true;
+		Series->Message = Message;
+		Series->Level = Level;
+		Series->bIsInt = bIsInt;
+		Series->Window.Add({ FPlatformTime::Seconds(), Value, FDateTime::UtcNow() });
+
+		if (Series->Window.Num() >= WindowSize)
+		{
+			ReduceWindow(*Series, PointsPerWindow, false);
+		}
+	});
+	return bTracked;
+}
+
+void FLoggerDownsample::Tick(float DeltaTime)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	TLoggerPerThread<FLoggerThreadSeries>::ForEach([Now](FLoggerThreadSeries& AllSeries)
+	{
+		for (auto It = AllSeries.CreateIterator(); It; ++It)
+		{
+			FLoggerSeries& Series = It.Value();
+
+			// End the series of destroyed callers here, so they do not hold slots until the next flush.
+			if (Series.bHasCaller && !Series.Caller.IsValid())
+			{
+				if (Series.Window.Num() > 0)
+				{
+					const int32 NumBuckets = FMath::DivideAndRoundUp(Series.Window.Num() * PointsPerWindow, WindowSize);
+					ReduceWindow(Series, NumBuckets, true);
+				}
+				It.RemoveCurrent();
+				continue;
+			}
+
+			if (FlushInterval > 0.f && Series.Window.Num() > 0 && Now - Series.Window[0].Seconds >= FlushInterval)
+			{
+				// Keep the share of points a full window would have kept.
+				const int32 NumBuckets = FMath::DivideAndRoundUp(Series.Window.Num() * PointsPerWindow, WindowSize);
+				ReduceWindow(Series, NumBuckets, false);
+			}
+		}
+	});
+}
+
+void FLoggerDownsample::Flush()
+{
+	TLoggerPerThread<FLoggerThreadSeries>::ForEach([](FLoggerThreadSeries& AllSeries)
+	{
+		for (auto It = AllSeries.CreateIterator(); It; ++It)
+		{
+			FLoggerSeries& Series = It.Value();
+			if (Series.Window.Num() > 0)
+			{
+				const int32 NumBuckets = FMath::DivideAndRoundUp(Series.Window.Num() * PointsPerWindow, WindowSize);
+				ReduceWindow(Series, NumBuckets, true);
+			}
+			if (Series.bHasCaller && !Series.Caller.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	});
+}
+
+void FLoggerDownsample::ReduceWindow(FLoggerSeries& Series, int32 NumBuckets, bool bEmitLast)
+{
+	const TArray<FLoggerSeriesPoint>& Points = Series.Window;
+	int32 Start = 0;
+
+	// The very first point of a series is always kept, and anchors the first triangle.
+	if (!Series.bHasAnchor)
+	{
+		EmitPoint(Series, Points[0]);
+		Series.Anchor = Points[0];
+		Series.bHasAnchor = true;
+		Start = 1;
+	}
+
+	const int32 NumPoints = Points.Num() - Start;
+	NumBuckets = FMath::Min(NumBuckets, NumPoints);
+	int32 LastChosen = INDEX_NONE;
+
+	for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+	{
+		const int32 BucketStart = Start + static_cast<int32>(static_cast<int64>(Bucket) * NumPoints / NumBuckets);
+		const int32 BucketEnd = Start + static_cast<int32>(static_cast<int64>(Bucket + 1) * NumPoints / NumBuckets);
+
+		// The third vertex is the average of the next bucket, or the last point for the last bucket.
+		double NextSeconds = Points.Last().Seconds;
+		double NextValue = Points.Last().Value;
+		if (Bucket + 1 < NumBuckets)
+		{
+			const int32 NextEnd = Start + static_cast<int32>(static_cast<int64>(Bucket + 2) * NumPoints / NumBuckets);
+			NextSeconds = 0.0;
+			NextValue = 0.0;
+			for (int32 Index = BucketEnd; Index < NextEnd; ++Index)
+			{
+				NextSeconds += Points[Index].Seconds;
+				NextValue += Points[Index].Value;
+			}
+			NextSeconds /= NextEnd - BucketEnd;
+			NextValue /= NextEnd - BucketEnd;
+		}
+
+		int32 Chosen = BucketStart;
+		double LargestArea = -1.0;
+		for (int32 Index = BucketStart; Index < BucketEnd; ++Index)
+		{
+			const double Area = GetDoubledArea(Series.Anchor.Seconds, Series.Anchor.Value, Points[Index].Seconds, Points[Index].Value, NextSeconds, NextValue);
+			if (Area > LargestArea)
+			{
+				LargestArea = Area;
+				Chosen = Index;
+			}
+		}
+
+		EmitPoint(Series, Points[Chosen]);
+		Series.Anchor = Points[Chosen];
+		LastChosen = Chosen;
+	}
+
+	if (bEmitLast && LastChosen != Points.Num() - 1 && Points.Num() > Start)
+	{
+		EmitPoint(Series, Points.Last());
+		Series.Anchor = Points.Last();
+	}
+
+	Series.Window.Reset();
+}
+
+void FLoggerDownsample::EmitPoint(const FLoggerSeries& Series, const FLoggerSeriesPoint& Point)
+{
+	const FString ValueString = Series.bIsInt ? FString::Printf(TEXT("%lld"), static_cast<int64>(Point.Value)) : FString::SanitizeFloat(Point.Value);
+	const FString Message = Series.Message + TEXT(": ") + ValueString;
+
+	// The final window of a destroyed caller is still emitted, under the name the caller had. Its
+	// points passed the gate when they were added, and the net filter cannot run without the caller.
+	UObject* Caller = Series.Caller.Get();
+	if (Series.bHasCaller && !Caller)
+	{
+		ULoggerLibrary::EmitMessageAs(Series.ContextName, Series.NetLabel, Message, Series.Level, Point.Time);
+		return;
+	}
+
+	if (ULoggerLibrary::ShouldLog(Caller, Series.Level))
+	{
+		ULoggerLibrary::EmitMessage(Caller, Message, Series.Level, Point.Time);
+	}
+}
@@ -0,0 +1,154 @@
+/**
+ * @file		LoggerDownsample.h
+ * @brief		Online Largest‑Triangle‑Three‑Buckets downsampling of logged numeric series.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoggerCallSite.h"
+#include "LoggerLibrary.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * @struct FLoggerSeriesKey
+ * @brief Identifies a series by its call site and caller. Without a call site, the message stands in for it.
+ */
+struct FLoggerSeriesKey
+{
+	FLoggerCallSite CallSite;
+	FObjectKey Caller;
+	FString Message;
+
+	bool operator==(const FLoggerSeriesKey& Other) const
+	{
+		return CallSite == Other.CallSite && Caller == Other.Caller && Message == Other.Message;
+	}
+
+	friend uint32 GetTypeHash(const FLoggerSeriesKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.CallSite), GetTypeHash(Key.Caller)), GetTypeHash(Key.Message));
+	}
+};
+
+/**
+ * @struct FLoggerSeriesPoint
+ * @brief A logged value and when it was logged.
+ */
+struct FLoggerSeriesPoint
+{
+	/** The platform time of the point, in seconds. The x axis of the triangles. */
+	double Seconds = 0.0;
+
+	double Value = 0.0;
+
+	/** The wall clock time of the point, which the emitted record carries. */
+	FDateTime Time;
+};
+
+/**
+ * @struct FLoggerSeries
+ * @brief The window of one series and the last point emitted from it.
+ */
+struct FLoggerSeries
+{
+	TWeakObjectPtr<UObject> Caller;
+
+	/** Whether the series was logged with a caller, so it ends when the caller is destroyed. */
+	bool bHasCaller = false;
+
+	/** The context name and net label of the caller, so the last points can still be emitted after it is destroyed. */
+	FString ContextName;
+	FString NetLabel;
+
+	FString Message;
+	ELoggerLevel Level = ELoggerLevel::Log;
+
+	/** Whether the series was logged with "Log Message with Int", so values are written as integers. */
+	bool bIsInt = false;
+
+	/** The points of the current window. Never grows past the window size. */
+	TArray<FLoggerSeriesPoint> Window;
+
+	/** The last point emitted, which is the first vertex of the next triangle. */
+	FLoggerSeriesPoint Anchor;
+	bool bHasAnchor = false;
+};
+
+/**
+ * @class FLoggerDownsample
+ * @brief Reduces high rate int and float series to the points that keep their shape.
+ *
+ * Points of each series fill a fixed window. A full window is cut into buckets, and from each
+ * bucket the point forming the largest triangle with the previously emitted point and the average
+ * of the next bucket is emitted, so peaks and dips survive while flat stretches collapse. The last
+ * bucket of a window uses the window's last point in place of the next average. Memory is bounded
+ * by the window size per series and "gronk.log.Downsample.MaxSeries" series; once that many are
+ * tracked, new series are logged unreduced.
+ */
+class FLoggerDownsample
+{
+public:
+	/** @return True if logged ints and floats are being downsampled. */
+	static bool IsEnabled() { return bEnabled; }
+
+	/**
+	 * @brief Enables, disables or resizes downsampling, first emitting every partial window.
+	 *
+	 * @param bInEnabled		Whether to downsample logged ints and floats.
+	 * @param InWindowSize		The number of points in a window.
+	 * @param InPointsPerWindow	The number of points emitted per window.
+	 * @param InFlushInterval	The age in seconds at which a partial window is reduced and emitted. Zero never does.
+	 */
+	static void Configure(bool bInEnabled, int32 InWindowSize, int32 InPointsPerWindow, float InFlushInterval);
+
+	/**
+	 * @brief Adds a point to the series of the calling call site and caller, emitting reduced points when its window fills.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Message	The message of the series.
+	 * @param Value		The logged value.
+	 * @param Level		Log level of the value.
+	 * @param bIsInt	Whether the value was logged as an int.
+	 * @return False if the series could not be tracked and the value should be logged as is.
+	 */
+	static bool Add(UObject* Caller, const FString& Message, double Value, ELoggerLevel Level, bool bIsInt);
+
+	/**
+	 * @brief Emits windows older than the flush interval, and ends the series of destroyed callers.
+	 *
+	 * @param DeltaTime The number of seconds since the last tick.
+	 */
+	static void Tick(float DeltaTime);
+
+	/**
+	 * @brief Reduces and emits every partial window, and forgets series whose caller is gone.
+	 */
+	static void Flush();
+
+private:
+	/**
+	 * @brief Reduces a window and emits the chosen points.
+	 *
+	 * @param Series		The series.
+	 * @param NumBuckets	The number of points to choose.
+	 * @param bEmitLast		Whether to also emit the last point of the window, ending the series there.
+	 */
+	static void ReduceWindow(FLoggerSeries& Series, int32 NumBuckets, bool bEmitLast);
+
+	/**
+	 * @brief Emits a point of a series as a record.
+	 *
+	 * @param Series	The series.
+	 * @param Point		The point.
+	 */
+	static void EmitPoint(const FLoggerSeries& Series, const FLoggerSeriesPoint& Point);
+
+	/** Whether logged ints and floats are downsampled. */
+	inline static bool bEnabled = false;
+
+	inline static int32 WindowSize = 256;
+	inline static int32 PointsPerWindow = 32;
+	inline static float FlushInterval = 5.f;
+};
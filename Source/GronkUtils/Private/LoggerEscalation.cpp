@@ -0,0 +1,83 @@
+/**
+ * @file		LoggerEscalation.cpp
+ * @brief		Temporarily lowers the log threshold of a context after it logs an error.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerEscalation.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeRWLock.h"
+
+// The time each escalated context expires, and the lock guarding the table.
+static TMap<FObjectKey, double> EscalationExpiry;
+static FRWLock EscalationLock;
+
+void FLoggerEscalation::Configure(bool bInEnabled, ELoggerLevel InEscalatedLevel, float InDuration)
+{
+	FWriteScopeLock ScopeLock(EscalationLock);
+
+	bEnabled = bInEnabled;
+	EscalatedLevel = InEscalatedLevel;
+	Duration = FMath::Max(InDuration, 0.f);
+
+	if (!bEnabled)
+	{
+		EscalationExpiry.Reset();
+		NumEscalated.store(0, std::memory_order_relaxed);
+	}
+}
+
+void FLoggerEscalation::NotifyEmitted(const UObject* Caller, ELoggerLevel Level)
+{
+	if (!bEnabled || Level != ELoggerLevel::Error)
+	{
+		return;
+	}
+
+	FWriteScopeLock ScopeLock(EscalationLock);
+	EscalationExpiry.Add(GetContextKey(Caller), FPlatformTime::Seconds() + Duration);
+	NumEscalated.store(EscalationExpiry.Num(), std::memory_order_relaxed);
+}
+
+void FLoggerEscalation::Tick()
+{
+	if (NumEscalated.load(std::memory_order_relaxed) == 0)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+
+	FWriteScopeLock ScopeLock(EscalationLock);
+	for (auto It = EscalationExpiry.CreateIterator(); It; ++It)
+	{
+		if (It.Value() <= Now)
+		{
+			It.RemoveCurrent();
+		}
+	}
+	NumEscalated.store(EscalationExpiry.Num(), std::memory_order_relaxed);
+}
+
+FObjectKey FLoggerEscalation::GetContextKey(const UObject* Caller)
+{
+	if (const UActorComponent* Component = Cast<UActorComponent>(Caller))
+	{
+		if (const AActor* Owner = Component->GetOwner())
+		{
+			return FObjectKey(Owner);
+		}
+	}
+	return FObjectKey(Caller);
+}
+
+bool FLoggerEscalation::IsContextEscalated(const UObject* Caller)
+{
+	const FObjectKey Key = GetContextKey(Caller);
+
+	FReadScopeLock ScopeLock(EscalationLock);
+	const double* Expiry = EscalationExpiry.Find(Key);
+	return Expiry && *Expiry > FPlatformTime::Seconds();
+}
@@ -0,0 +1,76 @@
+/**
+ * @file		LoggerEscalation.h
+ * @brief		Temporarily lowers the log threshold of a context after it logs an error.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoggerLibrary.h"
+#include "UObject/ObjectKey.h"
+#include <atomic>
+
+/**
+ * @class FLoggerEscalation
+ * @brief Lets every level down to the escalated level through for a while after a context logs an error.
+ *
+ * A context is the caller, or its owning actor when the caller is a component, matching the
+ * context name of logged messages. While nothing is escalated the gate only pays for one atomic
+ * load, and otherwise for one map lookup under a read lock.
+ */
+class FLoggerEscalation
+{
+public:
+	/**
+	 * @brief Configures escalation.
+	 *
+	 * @param bInEnabled		Whether errors escalate their context.
+	 * @param InEscalatedLevel	The lowest level let through while escalated.
+	 * @param InDuration		The number of seconds an escalation lasts after the last error.
+	 */
+	static void Configure(bool bInEnabled, ELoggerLevel InEscalatedLevel, float InDuration);
+
+	/**
+	 * @brief Escalates the caller's context if the level is an error.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Level		Log level of the emitted record.
+	 */
+	static void NotifyEmitted(const UObject* Caller, ELoggerLevel Level);
+
+	/**
+	 * @brief Checks whether the caller's context is escalated far enough to let a level through.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Level		Log level of the record.
+	 * @return True if the record should be emitted because of an escalation.
+	 */
+	static bool IsEscalated(const UObject* Caller, ELoggerLevel Level)
+	{
+		if (NumEscalated.load(std::memory_order_relaxed) == 0 || static_cast<uint8>(Level) < static_cast<uint8>(EscalatedLevel))
+		{
+			return false;
+		}
+		return IsContextEscalated(Caller);
+	}
+
+	/**
+	 * @brief Removes expired escalations.
+	 */
+	static void Tick();
+
+private:
+	/** @return The key of the caller's context. */
+	static FObjectKey GetContextKey(const UObject* Caller);
+
+	/** @return True if the caller's context has an unexpired escalation. */
+	static bool IsContextEscalated(const UObject* Caller);
+
+	inline static bool bEnabled = false;
+	inline static ELoggerLevel EscalatedLevel = ELoggerLevel::VeryVerbose;
+	inline static float Duration = 5.f;
+
+	/** The number of entries in the escalation table, checked before taking the lock. */
+	inline static std::atomic<int32> NumEscalated { 0 };
+};
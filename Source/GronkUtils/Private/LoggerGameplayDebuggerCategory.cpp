@@ -0,0 +1,107 @@
+/**
+ * @file		LoggerGameplayDebuggerCategory.cpp
+ * @brief		A Gameplay Debugger category showing the recent records of the debugged actor.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerGameplayDebuggerCategory.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "HAL/PlatformTime.h"
+#include "LoggerDebugRings.h"
+
+const FName FLoggerGameplayDebuggerCategory::CategoryName(TEXT("GronkLog"));
+
+/**
+ * @brief Gets the canvas color tag of a level.
+ *
+ * @param Level The logging level.
+ * @return The color tag.
+ */
+static const TCHAR* GetColorTagForLevel(ELoggerLevel Level)
+{
+	switch (Level)
+	{
+		case ELoggerLevel::VeryVerbose:	return TEXT("{grey}");
+		case ELoggerLevel::Verbose:		return TEXT("{grey}");
+		case ELoggerLevel::Display:		return TEXT("{cyan}");
+		case ELoggerLevel::Warning:		return TEXT("{yellow}");
+		case ELoggerLevel::Error:		return TEXT("{red}");
+		case ELoggerLevel::Fatal:		return TEXT("{red}");
+		default:						return TEXT("{white}");
+	}
+}
+
+FLoggerGameplayDebuggerCategory::FLoggerGameplayDebuggerCategory()
+{
+	bShowOnlyWithDebugActor = true;
+	SetDataPackReplication<FRepData>(&DataPack);
+}
+
+FLoggerGameplayDebuggerCategory::~FLoggerGameplayDebuggerCategory()
+{
+	OnGameplayDebuggerDeactivated();
+}
+
+void FLoggerGameplayDebuggerCategory::OnGameplayDebuggerActivated()
+{
+	if (!bHoldsSink)
+	{
+		FLoggerDebugRingSink::Acquire();
+		bHoldsSink = true;
+	}
+}
+
+void FLoggerGameplayDebuggerCategory::OnGameplayDebuggerDeactivated()
+{
+	if (bHoldsSink)
+	{
+		FLoggerDebugRingSink::Release();
+		bHoldsSink = false;
+	}
+}
+
+void FLoggerGameplayDebuggerCategory::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
+{
+	TArray<FLoggerDebugRecord> Records;
+	FLoggerDebugRingSink::GetRecords(DebugActor, Records);
+
+	const double Now = FPlatformTime::Seconds();
+	DataPack.Lines.Reset(Records.Num());
+	for (const FLoggerDebugRecord& Record : Records)
+	{
+		DataPack.Lines.Add(FString::Printf(TEXT("{grey}-%.1fs %s%s {white}%s: %s"),
+			Now - Record.Time,
+			GetColorTagForLevel(Record.Level),
+			*StaticEnum<ELoggerLevel>()->GetNameStringByValue(static_cast<int64>(Record.Level)),
+			*Record.ContextName,
+			*Record.Message));
+	}
+}
+
+void FLoggerGameplayDebuggerCategory::DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext)
+{
+	if (DataPack.Lines.Num() == 0)
+	{
+		CanvasContext.Printf(TEXT("{grey}No records logged by this actor since the debugger opened."));
+		return;
+	}
+
+	for (const FString& Line : DataPack.Lines)
+	{
+		CanvasContext.Print(Line);
+	}
+}
+
+TSharedRef<FGameplayDebuggerCategory> FLoggerGameplayDebuggerCategory::MakeInstance()
+{
+	return MakeShareable(new FLoggerGameplayDebuggerCategory());
+}
+
+void FLoggerGameplayDebuggerCategory::FRepData::Serialize(FArchive& Ar)
+{
+	Ar << Lines;
+}
+
+#endif // WITH_GAMEPLAY_DEBUGGER
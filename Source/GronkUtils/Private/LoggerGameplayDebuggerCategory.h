@@ -0,0 +1,59 @@
+/**
+ * @file		LoggerGameplayDebuggerCategory.h
+ * @brief		A Gameplay Debugger category showing the recent records of the debugged actor.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "GameplayDebuggerCategory.h"
+
+/**
+ * @class FLoggerGameplayDebuggerCategory
+ * @brief Shows the last records logged by the debugged actor and its components.
+ *
+ * Instances exist for every player controller of a non-shipping session, so the debug ring sink
+ * is only held while the Gameplay Debugger is active, and records are only kept while it is
+ * open. Only the debugged actor's records are formatted.
+ */
+class FLoggerGameplayDebuggerCategory : public FGameplayDebuggerCategory
+{
+public:
+	FLoggerGameplayDebuggerCategory();
+	virtual ~FLoggerGameplayDebuggerCategory() override;
+
+	virtual void CollectData(APlayerController* OwnerPC, AActor* DebugActor) override;
+	virtual void DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext) override;
+	virtual void OnGameplayDebuggerActivated() override;
+	virtual void OnGameplayDebuggerDeactivated() override;
+
+	/** @return A new instance of the category. */
+	static TSharedRef<FGameplayDebuggerCategory> MakeInstance();
+
+	/** The name the category is registered under. */
+	static const FName CategoryName;
+
+private:
+	/**
+	 * @struct FRepData
+	 * @brief The formatted lines sent from the server to the debugging client.
+	 */
+	struct FRepData
+	{
+		TArray<FString> Lines;
+
+		void Serialize(FArchive& Ar);
+	};
+
+	/** The data shown by the category. */
+	FRepData DataPack;
+
+	/** Whether this instance holds the debug ring sink. */
+	bool bHoldsSink = false;
+};
+
+#endif // WITH_GAMEPLAY_DEBUGGER
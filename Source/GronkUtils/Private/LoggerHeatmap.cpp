@@ -0,0 +1,183 @@
+/**
+ * @file		LoggerHeatmap.cpp
+ * @brief		Aggregates logged vectors into sparse spatial heatmaps.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerHeatmap.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/Archive.h"
+
+// The number of bits used for each axis of a packed cell key.
+static constexpr int32 CellAxisBits = 21;
+static constexpr uint64 CellAxisMask = (1ull << CellAxisBits) - 1;
+
+// The magic number at the start of binary heatmap files.
+static constexpr uint32 BinaryHeatmapMagic = 0x314D4847; // "GHM1"
+
+FLoggerHeatmap& FLoggerHeatmap::Get()
+{
+	static FLoggerHeatmap Instance;
+	return Instance;
+}
+
+void FLoggerHeatmap::Configure(bool bInEnabled, float InCellSize, float InFlushInterval, ELoggerHeatmapFormat InFormat)
+{
+	if (bEnabled && !bInEnabled)
+	{
+		Flush();
+	}
+
+	FScopeLock ScopeLock(&Lock);
+
+	// Cells of different sizes cannot share a grid, so dump before changing the size.
+	if (InCellSize != CellSize && Grids.Num() > 0)
+	{
+		ScopeLock.Unlock();
+		Flush();
+		ScopeLock.Lock();
+	}
+
+	CellSize = FMath::Max(InCellSize, UE_KINDA_SMALL_NUMBER);
+	FlushInterval = FMath::Max(InFlushInterval, 0.f);
+	Format = InFormat;
+	TimeSinceFlush = 0.f;
+	bEnabled = bInEnabled;
+}
+
+void FLoggerHeatmap::Add(const FString& Category, const FVector& Value)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	const FIntVector Cell(
+		FMath::FloorToInt32(Value.X / CellSize),
+		FMath::FloorToInt32(Value.Y / CellSize),
+		FMath::FloorToInt32(Value.Z / CellSize));
+
+	++Grids.FindOrAdd(Category).FindOrAdd(PackCell(Cell));
+}
+
+void FLoggerHeatmap::Tick(float DeltaTime)
+{
+	if (!bEnabled || FlushInterval <= 0.f)
+	{
+		return;
+	}
+
+	TimeSinceFlush += DeltaTime;
+	if (TimeSinceFlush >= FlushInterval)
+	{
+		Flush();
+	}
+}
+
+void FLoggerHeatmap::Flush(bool bWait)
+{
+	// Flushes are serialized so each one waits for the write before it, and files are named in flush order.
+	FScopeLock FlushScopeLock(&FlushLock);
+
+	TMap<FString, FGrid> FlushedGrids;
+	float FlushedCellSize;
+	ELoggerHeatmapFormat FlushedFormat;
+	{
+		FScopeLock ScopeLock(&Lock);
+		FlushedGrids = MoveTemp(Grids);
+		Grids.Reset();
+		FlushedCellSize = CellSize;
+		FlushedFormat = Format;
+		TimeSinceFlush = 0.f;
+	}
+
+	if (PendingWrite.IsValid())
+	{
+		PendingWrite.Wait();
+	}
+
+	if (FlushedGrids.Num() == 0)
+	{
+		return;
+	}
+
+	// Several flushes can happen within a second, so the sequence number keeps their files apart.
+	const FString Timestamp = FString::Printf(TEXT("%s_%u"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S-%s")), ++NumFlushes);
+
+	// Writing happens off the logging thread, since a dump can cover many thousands of cells.
+	PendingWrite = Async(EAsyncExecution::ThreadPool, [FlushedGrids = MoveTemp(FlushedGrids), FlushedCellSize, FlushedFormat, Timestamp]()
+	{
+		for (const TPair<FString, FGrid>& Pair : FlushedGrids)
+		{
+			WriteGrid(Pair.Key, Pair.Value, FlushedCellSize, FlushedFormat, Timestamp);
+		}
+	});
+
+	if (bWait)
+	{
+		PendingWrite.Wait();
+	}
+}
+
+uint64 FLoggerHeatmap::PackCell(const FIntVector& Cell)
+{
+	return ((static_cast<uint64>(Cell.X) & CellAxisMask) << (CellAxisBits * 2))
+		| ((static_cast<uint64>(Cell.Y) & CellAxisMask) << CellAxisBits)
+		| (static_cast<uint64>(Cell.Z) & CellAxisMask);
+}
+
+FIntVector FLoggerHeatmap::UnpackCell(uint64 Key)
+{
+	// Shift each axis to the top of an int64 and back down to sign extend it.
+	auto UnpackAxis = [](uint64 Bits) -> int32
+	{
+		return static_cast<int32>(static_cast<int64>(Bits << (64 - CellAxisBits)) >> (64 - CellAxisBits));
+	};
+
+	return FIntVector(
+		UnpackAxis((Key >> (CellAxisBits * 2)) & CellAxisMask),
+		UnpackAxis((Key >> CellAxisBits) & CellAxisMask),
+		UnpackAxis(Key & CellAxisMask));
+}
+
+void FLoggerHeatmap::WriteGrid(const FString& Category, const FGrid& Grid, float CellSize, ELoggerHeatmapFormat Format, const FString& Timestamp)
+{
+	const FString Directory = FPaths::Combine(FPaths::ProjectLogDir(), TEXT("GronkHeatmaps"));
+	const FString BaseName = FPaths::MakeValidFileName(Category.IsEmpty() ? TEXT("Uncategorized") : Category, TEXT('_'));
+
+	if (Format == ELoggerHeatmapFormat::Binary)
+	{
+		const FString FilePath = FPaths::Combine(Directory, FString::Printf(TEXT("%s_%s.ghm"), *BaseName, *Timestamp));
+		TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+		if (!Writer)
+		{
+			return;
+		}
+
+		uint32 Magic = BinaryHeatmapMagic;
+		uint32 NumCells = Grid.Num();
+		*Writer << Magic << CellSize << NumCells;
+
+		for (const TPair<uint64, uint32>& Pair : Grid)
+		{
+			FIntVector Cell = UnpackCell(Pair.Key);
+			uint32 Count = Pair.Value;
+			*Writer << Cell.X << Cell.Y << Cell.Z << Count;
+		}
+		return;
+	}
+
+	FString Csv;
+	Csv.Reserve(32 + Grid.Num() * 24);
+	Csv.Appendf(TEXT("# CellSize=%g\nX,Y,Z,Count\n"), CellSize);
+
+	for (const TPair<uint64, uint32>& Pair : Grid)
+	{
+		const FIntVector Cell = UnpackCell(Pair.Key);
+		Csv.Appendf(TEXT("%d,%d,%d,%u\n"), Cell.X, Cell.Y, Cell.Z, Pair.Value);
+	}
+
+	const FString FilePath = FPaths::Combine(Directory, FString::Printf(TEXT("%s_%s.csv"), *BaseName, *Timestamp));
+	FFileHelper::SaveStringToFile(Csv, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
@@ -0,0 +1,116 @@
+/**
+ * @file		LoggerHeatmap.h
+ * @brief		Aggregates logged vectors into sparse spatial heatmaps.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "LoggerLibrary.h"
+
+/**
+ * @class FLoggerHeatmap
+ * @brief Bins logged vectors into a sparse grid per category and periodically dumps the grids to disk.
+ *
+ * Memory is proportional to the number of occupied cells, and disk output is one file per
+ * category per flush rather than one line per logged vector.
+ */
+class FLoggerHeatmap
+{
+public:
+	/** @return The heatmap aggregator. */
+	static FLoggerHeatmap& Get();
+
+	/** @return True if logged vectors are being aggregated instead of logged as text. */
+	static bool IsEnabled() { return bEnabled; }
+
+	/**
+	 * @brief Enables or disables aggregation, flushing anything collected so far when disabling.
+	 *
+	 * @param bInEnabled		Whether to aggregate logged vectors.
+	 * @param InCellSize		The edge length of a grid cell, in world units.
+	 * @param InFlushInterval	The number of seconds between dumps. Zero only dumps on demand.
+	 * @param InFormat			The file format of the dumps.
+	 */
+	void Configure(bool bInEnabled, float InCellSize, float InFlushInterval, ELoggerHeatmapFormat InFormat);
+
+	/**
+	 * @brief Adds a vector to the grid of the given category.
+	 *
+	 * @param Category	The category of the vector.
+	 * @param Value		The vector to add.
+	 */
+	void Add(const FString& Category, const FVector& Value);
+
+	/**
+	 * @brief Dumps the grids if the flush interval has elapsed.
+	 *
+	 * @param DeltaTime The number of seconds since the last tick.
+	 */
+	void Tick(float DeltaTime);
+
+	/**
+	 * @brief Writes all grids to disk and clears them.
+	 *
+	 * @param bWait Whether to wait for the files to be written before returning.
+	 */
+	void Flush(bool bWait = false);
+
+private:
+	/** The occupied cells of a category, keyed by packed cell coordinates. */
+	using FGrid = TMap<uint64, uint32>;
+
+	/**
+	 * @brief Packs a cell's coordinates into a single key, 21 bits per axis.
+	 *
+	 * @param Cell The coordinates of the cell.
+	 * @return The packed key.
+	 */
+	static uint64 PackCell(const FIntVector& Cell);
+
+	/**
+	 * @brief Unpacks a key made by PackCell.
+	 *
+	 * @param Key The packed key.
+	 * @return The coordinates of the cell.
+	 */
+	static FIntVector UnpackCell(uint64 Key);
+
+	/**
+	 * @brief Writes one category's grid to a file.
+	 *
+	 * @param Category	The category of the grid.
+	 * @param Grid		The grid to write.
+	 * @param CellSize	The edge length of the grid's cells.
+	 * @param Format	The file format to write.
+	 * @param Timestamp	The timestamp and sequence number shared by all files of one flush.
+	 */
+	static void WriteGrid(const FString& Category, const FGrid& Grid, float CellSize, ELoggerHeatmapFormat Format, const FString& Timestamp);
+
+	/** Whether logged vectors are aggregated. Read without the lock on the logging path. */
+	inline static bool bEnabled = false;
+
+	float CellSize = 100.f;
+	float FlushInterval = 10.f;
+	ELoggerHeatmapFormat Format = ELoggerHeatmapFormat::Csv;
+
+	/** The number of seconds since the last flush. */
+	float TimeSinceFlush = 0.f;
+
+	/** The grid of each category. */
+	TMap<FString, FGrid> Grids;
+
+	/** Guards the grids and configuration. */
+	FCriticalSection Lock;
+
+	/** Serializes flushes. Taken before Lock. */
+	FCriticalSection FlushLock;
+
+	/** The background write of the last flush. Guarded by FlushLock. */
+	TFuture<void> PendingWrite;
+
+	/** The number of flushes that wrote files, which orders their names. Guarded by FlushLock. */
+	uint32 NumFlushes = 0;
+};
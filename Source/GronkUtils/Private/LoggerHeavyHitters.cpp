@@ -0,0 +1,124 @@
+/**
+ * @file		LoggerHeavyHitters.cpp
+ * @brief		Tracks the call sites and callers that log the most.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerHeavyHitters.h"
+#include "HAL/IConsoleManager.h"
+#include "LoggerCallSite.h"
+#include "LoggerLog.h"
+#include "LoggerSpaceSaving.h"
+#include "Misc/ScopeLock.h"
+
+// The number of entries each tracker contributes to the periodic summary.
+static constexpr int32 SummaryNum = 5;
+
+static float SummaryInterval = 0.f;
+static FAutoConsoleVariableRef CVarSummaryInterval(
+	TEXT("gronk.log.SummaryInterval"),
+	SummaryInterval,
+	TEXT("The number of seconds between summaries of the logging utilities. Zero disables them."));
+
+static FAutoConsoleCommand CmdTop(
+	TEXT("gronk.log.Top"),
+	TEXT("Logs the call sites and caller classes that have logged the most. Usage: gronk.log.Top [Num]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FLoggerHeavyHitters::LogTop(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10);
+	}));
+
+static FAutoConsoleCommand CmdTopReset(
+	TEXT("gronk.log.Top.Reset"),
+	TEXT("Forgets the call sites and caller classes tracked by gronk.log.Top."),
+	FConsoleCommandDelegate::CreateStatic(&FLoggerHeavyHitters::Reset));
+
+// The trackers and the lock guarding them.
+static FCriticalSection TrackerLock;
+static TLoggerSpaceSaving<FLoggerCallSite> CallSiteTracker(FLoggerHeavyHitters::Capacity);
+static TLoggerSpaceSaving<FName> CallerTracker(FLoggerHeavyHitters::Capacity);
+
+void FLoggerHeavyHitters::Record(const UObject* Caller)
+{
+	const FLoggerCallSite CallSite = FLoggerCallSite::GetCurrent();
+	const FName CallerClass = Caller ? Caller->GetClass()->GetFName() : NAME_None;
+
+	FScopeLock ScopeLock(&TrackerLock);
+	CallSiteTracker.Add(CallSite);
+	CallerTracker.Add(CallerClass);
+}
+
+void FLoggerHeavyHitters::LogTop(int32 Num)
+{
+	uint64 Total;
+	{
+		FScopeLock ScopeLock(&TrackerLock);
+		Total = CallSiteTracker.GetTotal();
+	}
+
+	UE_LOG(LogLoggerLibrary, Display, TEXT("[Top]\t%llu records tracked"), Total);
+
+	for (const TPair<FString, uint64>& Entry : GetTopCallSites(Num))
+	{
+		UE_LOG(LogLoggerLibrary, Display, TEXT("[Top]\tCall site %s: %llu"), *Entry.Key, Entry.Value);
+	}
+	for (const TPair<FString, uint64>& Entry : GetTopCallers(Num))
+	{
+		UE_LOG(LogLoggerLibrary, Display, TEXT("[Top]\tCaller %s: %llu"), *Entry.Key, Entry.Value);
+	}
+}
+
+void FLoggerHeavyHitters::Reset()
+{
+	FScopeLock ScopeLock(&TrackerLock);
+	CallSiteTracker.Reset();
+	CallerTracker.Reset();
+}
+
+TArray<TPair<FString, uint64>> FLoggerHeavyHitters::GetTopCallSites(int32 Num)
+{
+	TArray<TLoggerSpaceSaving<FLoggerCallSite>::FCounter> Counters;
+	{
+		FScopeLock ScopeLock(&TrackerLock);
+		Counters = CallSiteTracker.GetTop(Num);
+	}
+
+	TArray<TPair<FString, uint64>> Entries;
+	for (const TLoggerSpaceSaving<FLoggerCallSite>::FCounter& Counter : Counters)
+	{
+		Entries.Emplace(Counter.Key.ToString(), Counter.Count);
+	}
+	return Entries;
+}
+
+TArray<TPair<FString, uint64>> FLoggerHeavyHitters::GetTopCallers(int32 Num)
+{
+	TArray<TLoggerSpaceSaving<FName>::FCounter> Counters;
+	{
+		FScopeLock ScopeLock(&TrackerLock);
+		Counters = CallerTracker.GetTop(Num);
+	}
+
+	TArray<TPair<FString, uint64>> Entries;
+	for (const TLoggerSpaceSaving<FName>::FCounter& Counter : Counters)
+	{
+		Entries.Emplace(Counter.Key.IsNone() ? TEXT("UnknownContext") : Counter.Key.ToString(), Counter.Count);
+	}
+	return Entries;
+}
+
+void FLoggerHeavyHitters::Tick(float DeltaTime)
+{
+	if (SummaryInterval <= 0.f)
+	{
+		TimeSinceSummary = 0.f;
+		return;
+	}
+
+	TimeSinceSummary += DeltaTime;
+	if (TimeSinceSummary >= SummaryInterval)
+	{
+		TimeSinceSummary = 0.f;
+		LogTop(SummaryNum);
+	}
+}
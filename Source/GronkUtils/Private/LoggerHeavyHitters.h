@@ -0,0 +1,69 @@
+/**
+ * @file		LoggerHeavyHitters.h
+ * @brief		Tracks the call sites and callers that log the most.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @class FLoggerHeavyHitters
+ * @brief Keeps Space‑Saving top‑K trackers of emitted records by call site and by caller class.
+ *
+ * The trackers can be printed with "gronk.log.Top [Num]", and are included in the periodic summary
+ * when "gronk.log.SummaryInterval" is above zero.
+ */
+class FLoggerHeavyHitters
+{
+public:
+	/** The number of keys each tracker keeps. */
+	static constexpr int32 Capacity = 64;
+
+	/**
+	 * @brief Counts a record emitted from the current call site by the given caller.
+	 *
+	 * @param Caller The calling object.
+	 */
+	static void Record(const UObject* Caller);
+
+	/**
+	 * @brief Logs the most frequent call sites and caller classes.
+	 *
+	 * @param Num The number of entries to log from each tracker.
+	 */
+	static void LogTop(int32 Num);
+
+	/**
+	 * @brief Forgets everything tracked so far.
+	 */
+	static void Reset();
+
+	/**
+	 * @brief Gets the most frequent call sites.
+	 *
+	 * @param Num The maximum number of call sites to get.
+	 * @return The descriptions and counts of the call sites, most frequent first.
+	 */
+	static TArray<TPair<FString, uint64>> GetTopCallSites(int32 Num);
+
+	/**
+	 * @brief Gets the most frequent caller classes.
+	 *
+	 * @param Num The maximum number of caller classes to get.
+	 * @return The names and counts of the caller classes, most frequent first.
+	 */
+	static TArray<TPair<FString, uint64>> GetTopCallers(int32 Num);
+
+	/**
+	 * @brief Logs the periodic summary if its interval has elapsed.
+	 *
+	 * @param DeltaTime The number of seconds since the last tick.
+	 */
+	static void Tick(float DeltaTime);
+
+private:
+	/** The number of seconds since the last periodic summary. */
+	inline static float TimeSinceSummary = 0.f;
+};
@@ -6,122 +6,298 @@
 
 #include "LoggerLibrary.h"
 #include "Engine/Engine.h"
+#include "Engine/World.h"
 #include "Logging/LogMacros.h"
+#include "LoggerActorQuota.h"
+#include "LoggerCallerCache.h"
+#include "LoggerDownsample.h"
+#include "LoggerEscalation.h"
+#include "LoggerHeatmap.h"
+#include "LoggerHeavyHitters.h"
+#include "LoggerLog.h"
+#include "LoggerNetFilter.h"
+#include "LoggerOnceLatch.h"
+#include "LoggerQuantiles.h"
+#include "LoggerSessionStats.h"
+#include "LoggerSink.h"
+#include "LoggerTrace.h"
+#include "LoggerVisualLog.h"
+#include "LoggerWatchSubsystem.h"
 
-// Define a static log category for the logger library.
-DEFINE_LOG_CATEGORY_STATIC(LogLoggerLibrary, Log, All);
-
-// A static map to associate log levels with on‑screen colors.
-static const TMap<ELoggerLevel, FColor> LevelColorMap = {
-	{ ELoggerLevel::VeryVerbose, FColor::Purple },
-	{ ELoggerLevel::Verbose, FColor::Blue },
-	{ ELoggerLevel::Log, FColor::White },
-	{ ELoggerLevel::Display, FColor::Cyan },
-	{ ELoggerLevel::Warning, FColor::Yellow },
-	{ ELoggerLevel::Error, FColor::Red },
-	{ ELoggerLevel::Fatal, FColor::Magenta }
-};
+// Define the log category for the logger library.
+DEFINE_LOG_CATEGORY(LogLoggerLibrary);
 
 void ULoggerLibrary::SetDisplayLogLevel(ELoggerLevel NewDisplayLevel)
 {
 	DisplayLogLevel = NewDisplayLevel;
 }
 
+ELoggerLevel ULoggerLibrary::GetDisplayLogLevel()
+{
+	return DisplayLogLevel;
+}
+
+void ULoggerLibrary::SetOutputEnabled(ELoggerOutput Output, bool bEnabled)
+{
+	FLoggerSinks::SetOutputEnabled(Output, bEnabled);
+}
+
+void ULoggerLibrary::SetVectorHeatmapMode(bool bEnabled, float CellSize, float FlushInterval, ELoggerHeatmapFormat Format)
+{
+	FLoggerHeatmap::Get().Configure(bEnabled, CellSize, FlushInterval, Format);
+}
+
+void ULoggerLibrary::FlushVectorHeatmaps()
+{
+	FLoggerHeatmap::Get().Flush();
+}
+
+void ULoggerLibrary::SetFloatQuantileMode(bool bEnabled, float FlushInterval)
+{
+	FLoggerQuantiles::Configure(bEnabled, FlushInterval);
+}
+
+void ULoggerLibrary::FlushFloatQuantiles()
+{
+	FLoggerQuantiles::Flush();
+}
+
+void ULoggerLibrary::SetSeriesDownsampleMode(bool bEnabled, int32 WindowSize, int32 PointsPerWindow, float FlushInterval)
+{
+	FLoggerDownsample::Configure(bEnabled, WindowSize, PointsPerWindow, FlushInterval);
+}
+
+void ULoggerLibrary::FlushDownsampledSeries()
+{
+	FLoggerDownsample::Flush();
+}
+
+void ULoggerLibrary::SetVisualLoggerMode(bool bEnabled)
+{
+	FLoggerVisualLog::Configure(bEnabled);
+}
+
+void ULoggerLibrary::SetErrorEscalation(bool bEnabled, ELoggerLevel EscalatedLevel, float Duration)
+{
+	FLoggerEscalation::Configure(bEnabled, EscalatedLevel, Duration);
+}
+
+void ULoggerLibrary::SetNetFilter(TSubclassOf<UObject> CallerClass, int32 NetModes, int32 Roles)
+{
+	FLoggerNetFilter::SetFilter(CallerClass.Get(), static_cast<ELoggerNetMode>(NetModes), static_cast<ELoggerNetRole>(Roles));
+}
+
+void ULoggerLibrary::ClearNetFilters()
+{
+	FLoggerNetFilter::ClearFilters();
+}
+
+void ULoggerLibrary::SetActorLogQuota(int32 RecordsPerSecond)
+{
+	FLoggerActorQuota::Configure(RecordsPerSecond);
+}
+
 void ULoggerLibrary::LogMessage(UObject* Caller, const FString& Message, ELoggerLevel Level)
 {
-	// Determine the context name based on whether the caller is a component
-	FString ContextName;
-	if (UActorComponent* Component = Cast<UActorComponent>(Caller))
+	if (FLoggerTrace::IsCapturing())
 	{
-		if (AActor* Owner = Component->GetOwner())
-		{
-			ContextName = FString::Printf(TEXT("%s.%s"), *Owner->GetName(), *Component->GetName());
-		}
-		else
-		{
-			ContextName = Component->GetName();
-		}
+		FLoggerTrace::Capture(ELoggerTraceCall::Message, Caller, Message, Level);
 	}
-	else
+
+	if (!ShouldLog(Caller, Level))
 	{
-		ContextName = Caller ? Caller->GetName() : TEXT("UnknownContext");
+		return;
 	}
 
-	const FString LogString = FString::Printf(TEXT("[%s]\t%s: %s"), *UEnum::GetValueAsString(Level), *ContextName, *Message);
+	EmitMessage(Caller, Message, Level);
+}
 
-	switch (Level)
+void ULoggerLibrary::EmitMessage(UObject* Caller, const FString& Message, ELoggerLevel Level, const FDateTime& Time)
+{
+	if (!FLoggerActorQuota::TryConsume(Caller, Level))
 	{
-		case ELoggerLevel::VeryVerbose:
-			UE_LOG(LogLoggerLibrary, VeryVerbose, TEXT("%s"), *LogString);
-			break;
-		case ELoggerLevel::Verbose:
-			UE_LOG(LogLoggerLibrary, Verbose, TEXT("%s"), *LogString);
-			break;
-		case ELoggerLevel::Log:
-			UE_LOG(LogLoggerLibrary, Log, TEXT("%s"), *LogString);
-			break;
-		case ELoggerLevel::Display:
-			UE_LOG(LogLoggerLibrary, Display, TEXT("%s"), *LogString);
-			break;
-		case ELoggerLevel::Warning:
-			UE_LOG(LogLoggerLibrary, Warning, TEXT("%s"), *LogString);
-			break;
-		case ELoggerLevel::Error:
-			UE_LOG(LogLoggerLibrary, Error, TEXT("%s"), *LogString);
-			break;
-		case ELoggerLevel::Fatal:
-			UE_LOG(LogLoggerLibrary, Fatal, TEXT("%s"), *LogString);
-			break;
-		default:
-			UE_LOG(LogLoggerLibrary, Log, TEXT("%s"), *LogString);
-			break;
+		FLoggerSessionStats::RecordSuppressed(ELoggerGate::Quota);
+		return;
 	}
 
-	if (static_cast<uint8>(Level) >= static_cast<uint8>(DisplayLogLevel))
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	FLoggerHeavyHitters::Record(Caller);
+
+	uint64 BytesFormatted = 0;
+	FLoggerCallerCache::Access(Caller, [&](FLoggerCallerEntry& Entry)
 	{
-		if (GEngine)
-		{
-			FColor TextColor = GetColorForLevel(Level);
-			GEngine->AddOnScreenDebugMessage(-1, 5.f, TextColor, LogString);
-		}
-	}
+		const FLoggerRecord Record{ Level, Caller, Entry.ContextName, Message, Time, Entry.GetPrefix(Level), Entry.GetUtf8Prefix(Level), Entry.NetLabel };
+		BytesFormatted = FLoggerSinks::Dispatch(Record);
+	});
+
+	FLoggerEscalation::NotifyEmitted(Caller, Level);
+	FLoggerSessionStats::RecordEmitted(Level, BytesFormatted, FPlatformTime::Cycles64() - StartCycles);
+}
+
+void ULoggerLibrary::EmitMessageAs(const FString& ContextName, const FString& NetLabel, const FString& Message, ELoggerLevel Level, const FDateTime& Time)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// A one off entry, so the name is not cached against an object that no longer exists.
+	FLoggerCallerEntry Entry;
+	Entry.ContextName = ContextName;
+	Entry.NetLabel = NetLabel;
+
+	const FLoggerRecord Record{ Level, nullptr, Entry.ContextName, Message, Time, Entry.GetPrefix(Level), Entry.GetUtf8Prefix(Level), Entry.NetLabel };
+	const uint64 BytesFormatted = FLoggerSinks::Dispatch(Record);
+
+	FLoggerSessionStats::RecordEmitted(Level, BytesFormatted, FPlatformTime::Cycles64() - StartCycles);
 }
 
 void ULoggerLibrary::LogBool(UObject* Caller, const FString& Message, bool Value, ELoggerLevel Level)
 {
+	if (FLoggerTrace::IsCapturing())
+	{
+		FLoggerTrace::Capture(ELoggerTraceCall::Bool, Caller, Message, Level);
+	}
+
+	if (!ShouldLog(Caller, Level))
+	{
+		return;
+	}
+
 	FString FinalMessage = Message + TEXT(": ") + (Value ? TEXT("true") : TEXT("false"));
-	LogMessage(Caller, FinalMessage, Level);
+	EmitMessage(Caller, FinalMessage, Level);
 }
 
 void ULoggerLibrary::LogInt(UObject* Caller, const FString& Message, int32 Value, ELoggerLevel Level)
 {
+	if (FLoggerTrace::IsCapturing())
+	{
+		FLoggerTrace::Capture(ELoggerTraceCall::Int, Caller, Message, Level);
+	}
+
+	if (!ShouldLog(Caller, Level))
+	{
+		return;
+	}
+
+	if (FLoggerDownsample::IsEnabled() && FLoggerDownsample::Add(Caller, Message, Value, Level, true))
+	{
+		return;
+	}
+
 	FString FinalMessage = Message + TEXT(": ") + FString::FromInt(Value);
-	LogMessage(Caller, FinalMessage, Level);
+	EmitMessage(Caller, FinalMessage, Level);
 }
 
 void ULoggerLibrary::LogFloat(UObject* Caller, const FString& Message, double Value, ELoggerLevel Level)
 {
+	if (FLoggerTrace::IsCapturing())
+	{
+		FLoggerTrace::Capture(ELoggerTraceCall::Float, Caller, Message, Level);
+	}
+
+	if (!ShouldLog(Caller, Level))
+	{
+		return;
+	}
+
+	if (FLoggerQuantiles::IsEnabled())
+	{
+		FLoggerQuantiles::Add(Message, Value);
+		return;
+	}
+
+	if (FLoggerDownsample::IsEnabled() && FLoggerDownsample::Add(Caller, Message, Value, Level, false))
+	{
+		return;
+	}
+
 	FString FinalMessage = Message + TEXT(": ") + FString::SanitizeFloat(Value);
-	LogMessage(Caller, FinalMessage, Level);
+	EmitMessage(Caller, FinalMessage, Level);
 }
 
 void ULoggerLibrary::LogVector(UObject* Caller, const FString& Message, const FVector& Value, ELoggerLevel Level)
 {
+	if (FLoggerTrace::IsCapturing())
+	{
+		FLoggerTrace::Capture(ELoggerTraceCall::Vector, Caller, Message, Level);
+	}
+
+	if (FLoggerVisualLog::IsActive() && !FLoggerHeatmap::IsEnabled())
+	{
+		FLoggerVisualLog::Vector(Caller, Message, Value, Level);
+	}
+
+	if (!ShouldLog(Caller, Level))
+	{
+		return;
+	}
+
+	if (FLoggerHeatmap::IsEnabled())
+	{
+		FLoggerHeatmap::Get().Add(Message, Value);
+		return;
+	}
+
 	FString FinalMessage = Message + TEXT(": ") + Value.ToString();
-	LogMessage(Caller, FinalMessage, Level);
+	EmitMessage(Caller, FinalMessage, Level);
 }
 
 void ULoggerLibrary::LogRotator(UObject* Caller, const FString& Message, const FRotator& Value, ELoggerLevel Level)
 {
+	if (FLoggerTrace::IsCapturing())
+	{
+		FLoggerTrace::Capture(ELoggerTraceCall::Rotator, Caller, Message, Level);
+	}
+
+	if (FLoggerVisualLog::IsActive())
+	{
+		FLoggerVisualLog::Rotator(Caller, Message, Value, Level);
+	}
+
+	if (!ShouldLog(Caller, Level))
+	{
+		return;
+	}
+
+	FString FinalMessage = Message + TEXT(": ") + Value.ToString();
+	EmitMessage(Caller, FinalMessage, Level);
+}
+
+void ULoggerLibrary::LogTransform(UObject* Caller, const FString& Message, const FTransform& Value, ELoggerLevel Level)
+{
+	if (FLoggerTrace::IsCapturing())
+	{
+		FLoggerTrace::Capture(ELoggerTraceCall::Transform, Caller, Message, Level);
+	}
+
+	if (FLoggerVisualLog::IsActive())
+	{
+		FLoggerVisualLog::Transform(Caller, Message, Value, Level);
+	}
+
+	if (!ShouldLog(Caller, Level))
+	{
+		return;
+	}
+
 	FString FinalMessage = Message + TEXT(": ") + Value.ToString();
-	LogMessage(Caller, FinalMessage, Level);
+	EmitMessage(Caller, FinalMessage, Level);
 }
 
 void ULoggerLibrary::LogObject(UObject* Caller, const FString& Message, UObject* Value, ELoggerLevel Level)
 {
+	if (FLoggerTrace::IsCapturing())
+	{
+		FLoggerTrace::Capture(ELoggerTraceCall::Object, Caller, Message, Level);
+	}
+
+	if (!ShouldLog(Caller, Level))
+	{
+		return;
+	}
+
 	FString ObjectName = (Value != nullptr ? Value->GetName() : TEXT("NULL"));
 	FString FinalMessage = Message + TEXT(": ") + ObjectName;
-	LogMessage(Caller, FinalMessage, Level);
+	EmitMessage(Caller, FinalMessage, Level);
 }
 
 void ULoggerLibrary::LogOnValidity(UObject* Caller, UObject* InObject, EValidityOutcome& OutExecs, ELogValidityCondition Condition, const FString& Message, ELoggerLevel Level)
@@ -141,6 +317,10 @@ void ULoggerLibrary::LogOnValidity(UObject* Caller, UObject* InObject, EValidity
 	{
 		LogMessage(Caller, Message, Level);
 	}
+	else
+	{
+		FLoggerSessionStats::RecordSuppressed(ELoggerGate::Condition);
+	}
 
 	OutExecs = IsValid(InObject) ? EValidityOutcome::IsValid : EValidityOutcome::IsNotValid;
 }
@@ -151,15 +331,149 @@ void ULoggerLibrary::LogOnCondition(UObject* Caller, bool Condition, EConditionO
 	{
 		LogMessage(Caller, Message, Level);
 	}
+	else
+	{
+		FLoggerSessionStats::RecordSuppressed(ELoggerGate::Condition);
+	}
 
 	OutExecs = Condition ? EConditionOutcome::IsTrue : EConditionOutcome::IsFalse;
 }
 
-FColor ULoggerLibrary::GetColorForLevel(ELoggerLevel Level)
+void ULoggerLibrary::WatchObjectValidity(UObject* Caller, UObject* InObject, const FString& Message, ELoggerLevel Level)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(Caller, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	if (ULoggerWatchSubsystem* WatchSubsystem = World ? World->GetSubsystem<ULoggerWatchSubsystem>() : nullptr)
+	{
+		WatchSubsystem->WatchObjectValidity(Caller, InObject, Message, Level);
+	}
+}
+
+void ULoggerLibrary::StopWatchingObjectValidity(UObject* Caller, UObject* InObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(Caller, EGetWorldErrorMode::ReturnNull) : nullptr;
+	if (ULoggerWatchSubsystem* WatchSubsystem = World ? World->GetSubsystem<ULoggerWatchSubsystem>() : nullptr)
+	{
+		WatchSubsystem->StopWatchingObjectValidity(Caller, InObject);
+	}
+}
+
+bool ULoggerLibrary::WatchProperty(UObject* Caller, UObject* InObject, const FString& PropertyPath, ELoggerLevel Level)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(Caller, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	if (ULoggerWatchSubsystem* WatchSubsystem = World ? World->GetSubsystem<ULoggerWatchSubsystem>() : nullptr)
+	{
+		return WatchSubsystem->WatchProperty(Caller, InObject, PropertyPath, Level);
+	}
+	return false;
+}
+
+void ULoggerLibrary::StopWatchingProperty(UObject* Caller, UObject* InObject, const FString& PropertyPath)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(Caller, EGetWorldErrorMode::ReturnNull) : nullptr;
+	if (ULoggerWatchSubsystem* WatchSubsystem = World ? World->GetSubsystem<ULoggerWatchSubsystem>() : nullptr)
+	{
+		WatchSubsystem->StopWatchingProperty(Caller, InObject, PropertyPath);
+	}
+}
+
+FString ULoggerLibrary::WriteLogSessionSummary(const FString& FilePath)
+{
+	return FLoggerSessionStats::WriteSummary(FilePath);
+}
+
+bool ULoggerLibrary::ShouldLogMessage(UObject* Caller, ELoggerLevel Level)
+{
+	return ShouldLog(Caller, Level);
+}
+
+bool ULoggerLibrary::ShouldLogOnValidity(UObject* Caller, UObject* InObject, ELogValidityCondition LogCondition, ELoggerLevel Level, bool& bOutIsValid)
+{
+	bOutIsValid = IsValid(InObject);
+
+	if ((LogCondition == ELogValidityCondition::LogWhenValid) != bOutIsValid)
+	{
+		FLoggerSessionStats::RecordSuppressed(ELoggerGate::Condition);
+		return false;
+	}
+	return ShouldLog(Caller, Level);
+}
+
+bool ULoggerLibrary::ShouldLogOnCondition(UObject* Caller, bool Condition, ELogBooleanCondition LogCondition, ELoggerLevel Level, bool& bOutCondition)
+{
+	bOutCondition = Condition;
+
+	if ((LogCondition == ELogBooleanCondition::LogWhenTrue) != Condition)
+	{
+		FLoggerSessionStats::RecordSuppressed(ELoggerGate::Condition);
+		return false;
+	}
+	return ShouldLog(Caller, Level);
+}
+
+void ULoggerLibrary::ResetLogOnceLatches()
+{
+	FLoggerOnceLatch::Reset();
+}
+
+bool ULoggerLibrary::ShouldLogOnceAtCallSite(const void* CallSite, UObject* Caller, UObject* InObject, ELoggerLevel Level, bool bPerObject)
+{
+	// The latch is checked first, so a latched call site costs nothing else.
+	if (bPerObject ? FLoggerOnceLatch::IsLatchedForObject(CallSite, InObject) : FLoggerOnceLatch::IsLatched(CallSite))
+	{
+		FLoggerSessionStats::RecordSuppressed(ELoggerGate::Once);
+		return false;
+	}
+
+	// Only latch once the message is really emitted, so a suppressed level does not use up the log.
+	if (!ShouldLog(Caller, Level))
+	{
+		return false;
+	}
+
+	if (bPerObject)
+	{
+		FLoggerOnceLatch::LatchForObject(CallSite, InObject);
+	}
+	else
+	{
+		FLoggerOnceLatch::Latch(CallSite);
+	}
+	return true;
+}
+
+bool ULoggerLibrary::ShouldLog(const UObject* Caller, ELoggerLevel Level)
 {
-	if (const FColor* FoundColor = LevelColorMap.Find(Level))
+	// Fatal always goes through so the engine can bring the process down.
+	if (Level == ELoggerLevel::Fatal)
+	{
+		return true;
+	}
+
+	// Emitted if the output log accepts the verbosity or the level is shown on screen.
+	const bool bPassesLevel = !LogLoggerLibrary.IsSuppressed(ToLogVerbosity(Level))
+		|| (GEngine && static_cast<uint8>(Level) >= static_cast<uint8>(DisplayLogLevel))
+		|| FLoggerEscalation::IsEscalated(Caller, Level);
+
+	if (!bPassesLevel)
+	{
+		FLoggerSessionStats::RecordSuppressed(ELoggerGate::Level);
+		return false;
+	}
+
+	// The net filter needs the caller's cache entry, so it goes after the cheaper level check.
+	if (FLoggerNetFilter::IsEnabled() && !FLoggerNetFilter::Passes(Caller))
+	{
+		FLoggerSessionStats::RecordSuppressed(ELoggerGate::NetMode);
+		return false;
+	}
+
+	// Only checked here. The quota is used when the record is emitted, since the lazy nodes pass
+	// through this gate twice.
+	if (FLoggerActorQuota::IsEnabled() && FLoggerActorQuota::IsOverQuota(Caller, Level))
 	{
-		return *FoundColor;
+		FLoggerSessionStats::RecordSuppressed(ELoggerGate::Quota);
+		return false;
 	}
-	return FColor::White;
+
+	return true;
 }
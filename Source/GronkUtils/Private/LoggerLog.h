@@ -0,0 +1,35 @@
+/**
+ * @file		LoggerLog.h
+ * @brief		The log category shared by the logging utilities.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+#include "LoggerLibrary.h"
+
+// The log category every logging utility writes to.
+DECLARE_LOG_CATEGORY_EXTERN(LogLoggerLibrary, Log, All);
+
+/**
+ * @brief Converts a logger level to the matching engine verbosity.
+ *
+ * @param Level The logging level.
+ * @return The engine verbosity for the level.
+ */
+inline ELogVerbosity::Type ToLogVerbosity(ELoggerLevel Level)
+{
+	switch (Level)
+	{
+		case ELoggerLevel::VeryVerbose:	return ELogVerbosity::VeryVerbose;
+		case ELoggerLevel::Verbose:		return ELogVerbosity::Verbose;
+		case ELoggerLevel::Log:			return ELogVerbosity::Log;
+		case ELoggerLevel::Display:		return ELogVerbosity::Display;
+		case ELoggerLevel::Warning:		return ELogVerbosity::Warning;
+		case ELoggerLevel::Error:		return ELogVerbosity::Error;
+		case ELoggerLevel::Fatal:		return ELogVerbosity::Fatal;
+		default:						return ELogVerbosity::Log;
+	}
+}
@@ -0,0 +1,161 @@
+/**
+ * @file		LoggerNetFilter.cpp
+ * @brief		Gates records on the net mode and local role of their caller.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerNetFilter.h"
+#include "Components/ActorComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "LoggerCallerCache.h"
+#include "Misc/ScopeRWLock.h"
+
+/**
+ * @brief Finds the actor a caller is, or belongs to.
+ *
+ * @param Caller The calling object.
+ * @return The actor, or null if there is none.
+ */
+static const AActor* GetCallerActor(const UObject* Caller)
+{
+	if (const AActor* Actor = Cast<AActor>(Caller))
+	{
+		return Actor;
+	}
+	if (const UActorComponent* Component = Cast<UActorComponent>(Caller))
+	{
+		return Component->GetOwner();
+	}
+	return Caller ? Caller->GetTypedOuter<AActor>() : nullptr;
+}
+
+void FLoggerNetFilter::SetFilter(const UClass* CallerClass, ELoggerNetMode NetModes, ELoggerNetRole Roles)
+{
+	FWriteScopeLock ScopeLock(FiltersLock);
+
+	FFilter* Filter = Filters.FindByPredicate([CallerClass](const FFilter& Existing)
+	{
+		return CallerClass ? Existing.CallerClass.Get() == CallerClass : Existing.bAllClasses;
+	});
+	if (!Filter)
+	{
+		Filter = &Filters.AddDefaulted_GetRef();
+		Filter->CallerClass = CallerClass;
+		Filter->bAllClasses = CallerClass == nullptr;
+	}
+	Filter->NetModes = NetModes;
+	Filter->Roles = Roles;
+
+	bEnabled.store(true, std::memory_order_relaxed);
+	Generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FLoggerNetFilter::ClearFilters()
+{
+	FWriteScopeLock ScopeLock(FiltersLock);
+	Filters.Reset();
+	bEnabled.store(false, std::memory_order_relaxed);
+	Generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool FLoggerNetFilter::Passes(const UObject* Caller)
+{
+	bool bPasses = true;
+	FLoggerCallerCache::Access(Caller, [&](FLoggerCallerEntry& Entry)
+	{
+		const uint32 CurrentGeneration = Generation.load(std::memory_order_relaxed);
+		if (Entry.NetFilterGeneration != CurrentGeneration)
+		{
+			Entry.bPassesNetFilter = Decide(Caller, Entry);
+			Entry.NetFilterGeneration = CurrentGeneration;
+		}
+		bPasses = Entry.bPassesNetFilter;
+	});
+	return bPasses;
+}
+
+bool FLoggerNetFilter::Decide(const UObject* Caller, const FLoggerCallerEntry& Entry)
+{
+	const UClass* CallerClass = Caller ? Caller->GetClass() : nullptr;
+	const AActor* Actor = GetCallerActor(Caller);
+	const UClass* ActorClass = Actor ? Actor->GetClass() : nullptr;
+
+	FReadScopeLock ScopeLock(FiltersLock);
+
+	// The filter of the most derived matching class wins, and the filter for all classes loses to any.
+	const FFilter* BestFilter = nullptr;
+	const UClass* BestClass = nullptr;
+	for (const FFilter& Filter : Filters)
+	{
+		if (Filter.bAllClasses)
+		{
+			if (!BestFilter)
+			{
+				BestFilter = &Filter;
+			}
+			continue;
+		}
+
+		const UClass* FilterClass = Filter.CallerClass.Get();
+		if (!FilterClass)
+		{
+			continue;
+		}
+
+		const bool bMatches = (CallerClass && CallerClass->IsChildOf(FilterClass)) || (ActorClass && ActorClass->IsChildOf(FilterClass));
+		if (bMatches && (!BestClass || FilterClass->IsChildOf(BestClass)))
+		{
+			BestFilter = &Filter;
+			BestClass = FilterClass;
+		}
+	}
+
+	if (!BestFilter)
+	{
+		return true;
+	}
+	return EnumHasAnyFlags(BestFilter->NetModes, Entry.NetMode) && EnumHasAnyFlags(BestFilter->Roles, Entry.NetRole);
+}
+
+void FLoggerNetFilter::ResolveNetContext(const UObject* Caller, FLoggerCallerEntry& Entry)
+{
+	const UWorld* World = Caller ? Caller->GetWorld() : nullptr;
+	const ENetMode WorldNetMode = World ? World->GetNetMode() : NM_Standalone;
+
+	int32 PIEInstance = INDEX_NONE;
+	if (const FWorldContext* WorldContext = (GEngine && World) ? GEngine->GetWorldContextFromWorld(World) : nullptr)
+	{
+		PIEInstance = WorldContext->PIEInstance;
+	}
+
+	switch (WorldNetMode)
+	{
+		case NM_DedicatedServer:
+			Entry.NetMode = ELoggerNetMode::DedicatedServer;
+			Entry.NetLabel = TEXT("Server");
+			break;
+		case NM_ListenServer:
+			Entry.NetMode = ELoggerNetMode::ListenServer;
+			Entry.NetLabel = TEXT("ListenServer");
+			break;
+		case NM_Client:
+			Entry.NetMode = ELoggerNetMode::Client;
+			Entry.NetLabel = PIEInstance != INDEX_NONE ? FString::Printf(TEXT("Client %d"), PIEInstance) : TEXT("Client");
+			break;
+		default:
+			Entry.NetMode = ELoggerNetMode::Standalone;
+			Entry.NetLabel = TEXT("Standalone");
+			break;
+	}
+
+	const AActor* Actor = GetCallerActor(Caller);
+	switch (Actor ? Actor->GetLocalRole() : ROLE_None)
+	{
+		case ROLE_SimulatedProxy:	Entry.NetRole = ELoggerNetRole::SimulatedProxy; break;
+		case ROLE_AutonomousProxy:	Entry.NetRole = ELoggerNetRole::AutonomousProxy; break;
+		case ROLE_Authority:		Entry.NetRole = ELoggerNetRole::Authority; break;
+		default:					Entry.NetRole = ELoggerNetRole::NoActor; break;
+	}
+}
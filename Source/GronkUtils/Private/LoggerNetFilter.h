@@ -0,0 +1,92 @@
+/**
+ * @file		LoggerNetFilter.h
+ * @brief		Gates records on the net mode and local role of their caller.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoggerLibrary.h"
+#include <atomic>
+
+struct FLoggerCallerEntry;
+
+/**
+ * @class FLoggerNetFilter
+ * @brief Keeps the net filters and decides whether a caller passes them.
+ *
+ * The net mode and role of a caller are resolved once into its cache entry, along with the
+ * decision of the filters. Changing the filters bumps a generation, which makes every entry
+ * decide again the next time its caller logs.
+ */
+class FLoggerNetFilter
+{
+public:
+	/**
+	 * @brief Adds or replaces the filter of a class.
+	 *
+	 * @param CallerClass	The class the filter applies to, or null for every caller.
+	 * @param NetModes		The net modes to log in.
+	 * @param Roles			The local roles to log with.
+	 */
+	static void SetFilter(const UClass* CallerClass, ELoggerNetMode NetModes, ELoggerNetRole Roles);
+
+	/**
+	 * @brief Removes every filter.
+	 */
+	static void ClearFilters();
+
+	/** @return True if any filter is set. */
+	static bool IsEnabled() { return bEnabled.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Checks whether a caller passes the filters.
+	 *
+	 * @param Caller The calling object.
+	 * @return True if the caller's net mode and role are let through.
+	 */
+	static bool Passes(const UObject* Caller);
+
+	/**
+	 * @brief Resolves the net mode, role and label of a caller into its cache entry.
+	 *
+	 * @param Caller	The calling object. May be null.
+	 * @param Entry		The caller's entry.
+	 */
+	static void ResolveNetContext(const UObject* Caller, FLoggerCallerEntry& Entry);
+
+private:
+	/**
+	 * @struct FFilter
+	 * @brief The net modes and roles let through for a class.
+	 */
+	struct FFilter
+	{
+		TWeakObjectPtr<const UClass> CallerClass;
+		bool bAllClasses = false;
+		ELoggerNetMode NetModes = ELoggerNetMode::None;
+		ELoggerNetRole Roles = ELoggerNetRole::None;
+	};
+
+	/**
+	 * @brief Applies the filters to a caller.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Entry		The caller's entry, with its net context resolved.
+	 * @return True if the caller passes.
+	 */
+	static bool Decide(const UObject* Caller, const FLoggerCallerEntry& Entry);
+
+	/** The filters. */
+	inline static TArray<FFilter> Filters;
+
+	/** Guards the filters. */
+	inline static FRWLock FiltersLock;
+
+	/** Whether any filter is set. */
+	inline static std::atomic<bool> bEnabled { false };
+
+	/** Bumped whenever the filters change. Never zero. */
+	inline static std::atomic<uint32> Generation { 1 };
+};
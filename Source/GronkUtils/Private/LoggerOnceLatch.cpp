@@ -0,0 +1,150 @@
+/**
+ * @file		LoggerOnceLatch.cpp
+ * @brief		Latches that remember which call sites have already logged once.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerOnceLatch.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+std::atomic<const void*> FLoggerOnceLatch::Slots[FLoggerOnceLatch::NumSlots] = {};
+std::atomic<int32> FLoggerOnceLatch::NumOccupied { 0 };
+
+// Call sites latched after the lock free table filled up.
+static TSet<const void*> OverflowLatches;
+
+// The objects each call site has logged about, for the per object latch.
+static TMap<const void*, TSet<FObjectKey>> ObjectLatches;
+
+// Guards the overflow and per object latches.
+static FCriticalSection LatchLock;
+
+// Bumped by every reset, so per thread caches of per object latches know to clear themselves.
+static std::atomic<uint32> LatchGeneration { 1 };
+
+/**
+ * @struct FObjectLatchCache
+ * @brief The per object latches a thread has already seen, so checking them again takes no lock.
+ */
+struct FObjectLatchCache
+{
+	/** The generation the latches belong to. */
+	uint32 Generation = 0;
+
+	TSet<TPair<const void*, FObjectKey>> Latched;
+};
+
+static thread_local FObjectLatchCache ObjectLatchCache;
+
+static FAutoConsoleCommand CmdResetOnce(
+	TEXT("gronk.log.ResetOnce"),
+	TEXT("Releases the latches of the Log Once nodes, so each of them logs once more."),
+	FConsoleCommandDelegate::CreateStatic(&FLoggerOnceLatch::Reset));
+
+bool FLoggerOnceLatch::IsLatched(const void* CallSite)
+{
+	uint32 Slot = GetSlot(CallSite);
+	for (int32 Probe = 0; Probe < NumSlots; ++Probe, Slot = (Slot + 1) & (NumSlots - 1))
+	{
+		const void* Occupant = Slots[Slot].load(std::memory_order_acquire);
+		if (Occupant == CallSite)
+		{
+			return true;
+		}
+		if (Occupant == nullptr)
+		{
+			break;
+		}
+	}
+
+	if (NumOccupied.load(std::memory_order_relaxed) < NumSlots / 2)
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&LatchLock);
+	return OverflowLatches.Contains(CallSite);
+}
+
+void FLoggerOnceLatch::Latch(const void* CallSite)
+{
+	// Keep the table at most half full so probes stay short and always find an empty slot.
+	if (NumOccupied.load(std::memory_order_relaxed) < NumSlots / 2)
+	{
+		uint32 Slot = GetSlot(CallSite);
+		for (int32 Probe = 0; Probe < NumSlots; ++Probe, Slot = (Slot + 1) & (NumSlots - 1))
+		{
+			const void* Expected = nullptr;
+			if (Slots[Slot].compare_exchange_strong(Expected, CallSite, std::memory_order_acq_rel))
+			{
+				NumOccupied.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			if (Expected == CallSite)
+			{
+				return;
+			}
+		}
+	}
+
+	FScopeLock ScopeLock(&LatchLock);
+	OverflowLatches.Add(CallSite);
+}
+
+bool FLoggerOnceLatch::IsLatchedForObject(const void* CallSite, const UObject* Object)
+{
+	const TPair<const void*, FObjectKey> Key(CallSite, FObjectKey(Object));
+
+	// Latches only ever get released by a reset, so a latch seen by this thread stays valid until the generation moves.
+	FObjectLatchCache& Cache = ObjectLatchCache;
+	const uint32 Generation = LatchGeneration.load(std::memory_order_acquire);
+	if (Cache.Generation != Generation)
+	{
+		Cache.Latched.Reset();
+		Cache.Generation = Generation;
+	}
+	else if (Cache.Latched.Contains(Key))
+	{
+		return true;
+	}
+
+	bool bLatched;
+	{
+		FScopeLock ScopeLock(&LatchLock);
+		const TSet<FObjectKey>* Objects = ObjectLatches.Find(CallSite);
+		bLatched = Objects && Objects->Contains(Key.Value);
+	}
+
+	if (bLatched)
+	{
+		Cache.Latched.Add(Key);
+	}
+	return bLatched;
+}
+
+void FLoggerOnceLatch::LatchForObject(const void* CallSite, const UObject* Object)
+{
+	FScopeLock ScopeLock(&LatchLock);
+	ObjectLatches.FindOrAdd(CallSite).Add(FObjectKey(Object));
+}
+
+void FLoggerOnceLatch::Reset()
+{
+	FScopeLock ScopeLock(&LatchLock);
+
+	for (std::atomic<const void*>& Slot : Slots)
+	{
+		Slot.store(nullptr, std::memory_order_release);
+	}
+	NumOccupied.store(0, std::memory_order_relaxed);
+
+	OverflowLatches.Reset();
+	ObjectLatches.Reset();
+	LatchGeneration.fetch_add(1, std::memory_order_release);
+}
+
+uint32 FLoggerOnceLatch::GetSlot(const void* CallSite)
+{
+	return GetTypeHash(CallSite) & (NumSlots - 1);
+}
@@ -0,0 +1,75 @@
+/**
+ * @file		LoggerOnceLatch.h
+ * @brief		Latches that remember which call sites have already logged once.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include <atomic>
+
+/**
+ * @class FLoggerOnceLatch
+ * @brief Remembers the call sites, and call site and object pairs, that have already logged.
+ *
+ * Call sites are identified by the address of their bytecode. Latched call sites are kept in a
+ * fixed, lock free open addressing table, so checking a latched call site is a hash and usually
+ * a single compare. The per object variant keeps a sparse set of objects for each call site, and
+ * each thread caches the pairs it has found latched, so checking them again takes no lock. Resets
+ * bump a generation that clears those caches on their next use.
+ */
+class FLoggerOnceLatch
+{
+public:
+	/**
+	 * @brief Checks whether a call site has already logged.
+	 *
+	 * @param CallSite The address identifying the call site.
+	 * @return True if the call site is latched.
+	 */
+	static bool IsLatched(const void* CallSite);
+
+	/**
+	 * @brief Latches a call site.
+	 *
+	 * @param CallSite The address identifying the call site.
+	 */
+	static void Latch(const void* CallSite);
+
+	/**
+	 * @brief Checks whether a call site has already logged for an object.
+	 *
+	 * @param CallSite	The address identifying the call site.
+	 * @param Object	The object the call site logs about.
+	 * @return True if the call site is latched for the object.
+	 */
+	static bool IsLatchedForObject(const void* CallSite, const UObject* Object);
+
+	/**
+	 * @brief Latches a call site for an object.
+	 *
+	 * @param CallSite	The address identifying the call site.
+	 * @param Object	The object the call site logs about.
+	 */
+	static void LatchForObject(const void* CallSite, const UObject* Object);
+
+	/**
+	 * @brief Releases every latch, so every call site logs once more.
+	 */
+	static void Reset();
+
+private:
+	/** The number of slots in the lock free table. Must be a power of two. */
+	static constexpr int32 NumSlots = 4096;
+
+	/** @return The first slot to probe for a call site. */
+	static uint32 GetSlot(const void* CallSite);
+
+	/** The latched call sites. Empty slots are null. */
+	static std::atomic<const void*> Slots[NumSlots];
+
+	/** The number of occupied slots, so insertion stops before the table is completely full. */
+	static std::atomic<int32> NumOccupied;
+};
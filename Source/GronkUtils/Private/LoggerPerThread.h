@@ -0,0 +1,108 @@
+/**
+ * @file		LoggerPerThread.h
+ * @brief		Per‑thread state for the logging utilities, merged on demand.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
+
+/**
+ * @class TLoggerPerThread
+ * @brief Gives every thread its own instance of a value, and lets a reader visit all of them.
+ *
+ * Writers only take the lock of their own thread's slot, which is uncontended except while a
+ * reader is merging. There is one set of slots per value type, and slots outlive their threads
+ * so nothing recorded is lost when a thread exits.
+ *
+ * @tparam T The type of the per‑thread value. Must be default constructible.
+ */
+template <typename T>
+class TLoggerPerThread
+{
+public:
+	/**
+	 * @brief Runs a function on the calling thread's value.
+	 *
+	 * @param Func The function to run, taking a T&.
+	 */
+	template <typename FuncType>
+	static void Modify(FuncType&& Func)
+	{
+		FSlot& Slot = GetLocalSlot();
+		FScopeLock ScopeLock(&Slot.Lock);
+		Func(Slot.Value);
+	}
+
+	/**
+	 * @brief Gets the calling thread's value without taking its lock.
+	 *
+	 * Only for values that are safe to read while their thread writes them, such as relaxed atomics.
+	 *
+	 * @return The calling thread's value.
+	 */
+	static T& GetLocal()
+	{
+		return GetLocalSlot().Value;
+	}
+
+	/**
+	 * @brief Runs a function on every thread's value.
+	 *
+	 * @param Func The function to run, taking a T&.
+	 */
+	template <typename FuncType>
+	static void ForEach(FuncType&& Func)
+	{
+		FScopeLock RegistryScopeLock(&GetRegistryLock());
+		for (const TUniquePtr<FSlot>& Slot : GetSlots())
+		{
+			FScopeLock ScopeLock(&Slot->Lock);
+			Func(Slot->Value);
+		}
+	}
+
+private:
+	/**
+	 * @struct FSlot
+	 * @brief A thread's value and the lock guarding it.
+	 */
+	struct FSlot
+	{
+		FCriticalSection Lock;
+		T Value;
+	};
+
+	/** @return The calling thread's slot, registering it on first use. */
+	static FSlot& GetLocalSlot()
+	{
+		if (LocalSlot == nullptr)
+		{
+			TUniquePtr<FSlot> NewSlot = MakeUnique<FSlot>();
+			LocalSlot = NewSlot.Get();
+
+			FScopeLock RegistryScopeLock(&GetRegistryLock());
+			GetSlots().Add(MoveTemp(NewSlot));
+		}
+		return *LocalSlot;
+	}
+
+	/** @return The lock guarding the list of slots. */
+	static FCriticalSection& GetRegistryLock()
+	{
+		static FCriticalSection RegistryLock;
+		return RegistryLock;
+	}
+
+	/** @return The slots of every thread that has used this type. */
+	static TArray<TUniquePtr<FSlot>>& GetSlots()
+	{
+		static TArray<TUniquePtr<FSlot>> Slots;
+		return Slots;
+	}
+
+	/** The calling thread's slot. */
+	inline static thread_local FSlot* LocalSlot = nullptr;
+};
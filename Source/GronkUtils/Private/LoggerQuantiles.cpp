@@ -0,0 +1,269 @@
+/**
+ * @file		LoggerQuantiles.cpp
+ * @brief		Mergeable streaming quantile sketches for logged numeric values.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerQuantiles.h"
+#include "LoggerLibrary.h"
+#include "LoggerPerThread.h"
+
+// The ratio between the bounds of consecutive bins, and its logarithm.
+static const double Gamma = (1.0 + FLoggerQuantileSketch::RelativeAccuracy) / (1.0 - FLoggerQuantileSketch::RelativeAccuracy);
+static const double LogGamma = FMath::Loge(Gamma);
+
+// Values with a smaller magnitude are counted as zero.
+static constexpr double MinIndexableValue = 1e-9;
+
+// The largest bin index magnitude. Every finite double lands well inside this, so it only keeps
+// the store's offset arithmetic from overflowing.
+static constexpr int32 MaxIndexMagnitude = 1 << 16;
+
+// The sketches of one thread, keyed by message.
+using FLoggerThreadSketches = TMap<FString, FLoggerQuantileSketch>;
+
+void FLoggerQuantileSketch::FStore::Add(int32 Index, uint64 InCount)
+{
+	Total += InCount;
+
+	if (Counts.Num() == 0)
+	{
+		Offset = Index;
+		Counts.Add(InCount);
+		return;
+	}
+
+	if (Index < Offset)
+	{
+		// Growing downwards past the limit would only add detail to the lowest values, so collapse instead.
+		const int32 NumToAdd = FMath::Min(Offset - Index, MaxBins - Counts.Num());
+		if (NumToAdd <= 0)
+		{
+			Counts[0] += InCount;
+			return;
+		}
+
+		Counts.InsertZeroed(0, NumToAdd);
+		Offset -= NumToAdd;
+		Counts[FMath::Max(Index - Offset, 0)] += InCount;
+		return;
+	}
+
+	const int32 Top = Offset + Counts.Num() - 1;
+	if (Index > Top)
+	{
+		Counts.AddZeroed(Index - Top);
+
+		// Collapse the lowest bins into the new lowest bin to stay within the limit.
+		const int32 NumToCollapse = Counts.Num() - MaxBins;
+		if (NumToCollapse > 0)
+		{
+			uint64 Collapsed = 0;
+			for (int32 CollapseIndex = 0; CollapseIndex < NumToCollapse; ++CollapseIndex)
+			{
+				Collapsed += Counts[CollapseIndex];
+			}
+			Counts.RemoveAt(0, NumToCollapse, false);
+			Counts[0] += Collapsed;
+			Offset += NumToCollapse;
+		}
+	}
+
+	Counts[Index - Offset] += InCount;
+}
+
+void FLoggerQuantileSketch::FStore::Merge(const FStore& Other)
+{
+	// Add from the top down so the store grows upwards at most once.
+	for (int32 BinIndex = Other.Counts.Num() - 1; BinIndex >= 0; --BinIndex)
+	{
+		if (Other.Counts[BinIndex] > 0)
+		{
+			Add(Other.Offset + BinIndex, Other.Counts[BinIndex]);
+		}
+	}
+}
+
+int32 FLoggerQuantileSketch::FStore::GetIndexAtRank(uint64 Rank) const
+{
+	uint64 Seen = 0;
+	for (int32 BinIndex = 0; BinIndex < Counts.Num(); ++BinIndex)
+	{
+		Seen += Counts[BinIndex];
+		if (Seen > Rank)
+		{
+			return Offset + BinIndex;
+		}
+	}
+	return Offset + Counts.Num() - 1;
+}
+
+void FLoggerQuantileSketch::Add(double Value)
+{
+	if (FMath::IsNaN(Value))
+	{
+		++NaNCount;
+		return;
+	}
+
+	if (Value > TNumericLimits<double>::Max())
+	{
+		++PositiveInfinityCount;
+	}
+	else if (Value < TNumericLimits<double>::Lowest())
+	{
+		++NegativeInfinityCount;
+	}
+	else if (Value > MinIndexableValue)
+	{
+		Positive.Add(GetIndex(Value), 1);
+	}
+	else if (Value < -MinIndexableValue)
+	{
+		Negative.Add(GetIndex(-Value), 1);
+	}
+	else
+	{
+		++ZeroCount;
+	}
+
+	++Count;
+	Min = FMath::Min(Min, Value);
+	Max = FMath::Max(Max, Value);
+}
+
+void FLoggerQuantileSketch::Merge(const FLoggerQuantileSketch& Other)
+{
+	Positive.Merge(Other.Positive);
+	Negative.Merge(Other.Negative);
+	ZeroCount += Other.ZeroCount;
+	NegativeInfinityCount += Other.NegativeInfinityCount;
+	PositiveInfinityCount += Other.PositiveInfinityCount;
+	NaNCount += Other.NaNCount;
+
+	Count += Other.Count;
+	Min = FMath::Min(Min, Other.Min);
+	Max = FMath::Max(Max, Other.Max);
+}
+
+double FLoggerQuantileSketch::GetQuantile(double Quantile) const
+{
+	if (Count == 0)
+	{
+		return 0.0;
+	}
+
+	const uint64 Rank = static_cast<uint64>(FMath::Clamp(Quantile, 0.0, 1.0) * static_cast<double>(Count - 1));
+
+	// Negative infinities come first, then negative values, largest magnitude first, then zeros,
+	// then positive values, then positive infinities.
+	const uint64 NegativeEnd = NegativeInfinityCount + Negative.Total;
+	const uint64 PositiveEnd = NegativeEnd + ZeroCount + Positive.Total;
+
+	// Min and Max hold the infinities themselves whenever any were added.
+	if (Rank < NegativeInfinityCount)
+	{
+		return Min;
+	}
+	if (Rank >= PositiveEnd)
+	{
+		return Max;
+	}
+
+	double Value;
+	if (Rank < NegativeEnd)
+	{
+		Value = -GetValue(Negative.GetIndexAtRank(NegativeEnd - 1 - Rank));
+	}
+	else if (Rank < NegativeEnd + ZeroCount)
+	{
+		Value = 0.0;
+	}
+	else
+	{
+		Value = GetValue(Positive.GetIndexAtRank(Rank - NegativeEnd - ZeroCount));
+	}
+
+	// The bin's representative value can fall just outside what was actually seen.
+	return FMath::Clamp(Value, Min, Max);
+}
+
+int32 FLoggerQuantileSketch::GetIndex(double Value)
+{
+	return FMath::Clamp(FMath::CeilToInt32(FMath::Loge(Value) / LogGamma), -MaxIndexMagnitude, MaxIndexMagnitude);
+}
+
+double FLoggerQuantileSketch::GetValue(int32 Index)
+{
+	return 2.0 * FMath::Pow(Gamma, static_cast<double>(Index)) / (Gamma + 1.0);
+}
+
+void FLoggerQuantiles::Configure(bool bInEnabled, float InFlushInterval)
+{
+	if (bEnabled && !bInEnabled)
+	{
+		Flush();
+	}
+
+	FlushInterval = FMath::Max(InFlushInterval, 0.f);
+	TimeSinceFlush = 0.f;
+	bEnabled = bInEnabled;
+}
+
+void FLoggerQuantiles::Add(const FString& Key, double Value)
+{
+	TLoggerPerThread<FLoggerThreadSketches>::Modify([&Key, Value](FLoggerThreadSketches& Sketches)
+	{
+		Sketches.FindOrAdd(Key).Add(Value);
+	});
+}
+
+void FLoggerQuantiles::Tick(float DeltaTime)
+{
+	if (!bEnabled || FlushInterval <= 0.f)
+	{
+		return;
+	}
+
+	TimeSinceFlush += DeltaTime;
+	if (TimeSinceFlush >= FlushInterval)
+	{
+		Flush();
+	}
+}
+
+void FLoggerQuantiles::Flush()
+{
+	TimeSinceFlush = 0.f;
+
+	FLoggerThreadSketches Merged;
+	TLoggerPerThread<FLoggerThreadSketches>::ForEach([&Merged](FLoggerThreadSketches& Sketches)
+	{
+		for (const TPair<FString, FLoggerQuantileSketch>& Pair : Sketches)
+		{
+			Merged.FindOrAdd(Pair.Key).Merge(Pair.Value);
+		}
+		Sketches.Reset();
+	});
+
+	Merged.KeySort(TLess<FString>());
+	for (const TPair<FString, FLoggerQuantileSketch>& Pair : Merged)
+	{
+		const FLoggerQuantileSketch& Sketch = Pair.Value;
+		FString Report = FString::Printf(TEXT("[Quantiles] %s: n=%llu p50=%s p90=%s p99=%s max=%s"),
+			*Pair.Key,
+			Sketch.GetCount(),
+			*FString::SanitizeFloat(Sketch.GetQuantile(0.5)),
+			*FString::SanitizeFloat(Sketch.GetQuantile(0.9)),
+			*FString::SanitizeFloat(Sketch.GetQuantile(0.99)),
+			*FString::SanitizeFloat(Sketch.GetMax()));
+
+		if (Sketch.GetNaNCount() > 0)
+		{
+			Report += FString::Printf(TEXT(" nan=%llu"), Sketch.GetNaNCount());
+		}
+
+		// The values were already gated when they were added, so the report goes straight to the sinks.
+		ULoggerLibrary::EmitMessage(nullptr, Report, ELoggerLevel::Display);
+	}
+}
@@ -0,0 +1,162 @@
+/**
+ * @file		LoggerQuantiles.h
+ * @brief		Mergeable streaming quantile sketches for logged numeric values.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @class FLoggerQuantileSketch
+ * @brief A DDSketch: a quantile sketch with bounded relative error and bounded memory.
+ *
+ * Values are counted in logarithmically sized bins, so any quantile is within 1% of the true
+ * value. Each sign keeps at most MaxBins bins; past that the lowest bins are collapsed together,
+ * which only costs accuracy on the lowest quantiles. Two sketches merge by adding bin counts.
+ * Infinities rank below and above every binned value, and NaNs are counted but not ranked.
+ */
+class FLoggerQuantileSketch
+{
+public:
+	/** The relative accuracy of the sketch. */
+	static constexpr double RelativeAccuracy = 0.01;
+
+	/** The maximum number of bins kept for each sign. */
+	static constexpr int32 MaxBins = 2048;
+
+	/**
+	 * @brief Adds a value to the sketch.
+	 *
+	 * @param Value The value to add.
+	 */
+	void Add(double Value);
+
+	/**
+	 * @brief Adds the values of another sketch to this one.
+	 *
+	 * @param Other The sketch to merge in.
+	 */
+	void Merge(const FLoggerQuantileSketch& Other);
+
+	/**
+	 * @brief Estimates a quantile of the added values.
+	 *
+	 * @param Quantile The quantile to estimate, between 0 and 1.
+	 * @return The estimated value, or zero if the sketch is empty.
+	 */
+	double GetQuantile(double Quantile) const;
+
+	/** @return The number of values added, excluding NaNs. */
+	uint64 GetCount() const { return Count; }
+
+	/** @return The number of NaNs added. */
+	uint64 GetNaNCount() const { return NaNCount; }
+
+	/** @return The smallest value added. */
+	double GetMin() const { return Min; }
+
+	/** @return The largest value added. */
+	double GetMax() const { return Max; }
+
+private:
+	/**
+	 * @struct FStore
+	 * @brief A contiguous run of bin counts.
+	 */
+	struct FStore
+	{
+		/** The count of each bin, starting at bin Offset. */
+		TArray<uint64> Counts;
+
+		/** The index of the first bin in Counts. */
+		int32 Offset = 0;
+
+		/** The sum of all counts. */
+		uint64 Total = 0;
+
+		void Add(int32 Index, uint64 InCount);
+		void Merge(const FStore& Other);
+
+		/**
+		 * @brief Finds the bin containing the value of the given rank.
+		 *
+		 * @param Rank			The zero based rank, counted from the lowest bin.
+		 * @return The index of the bin.
+		 */
+		int32 GetIndexAtRank(uint64 Rank) const;
+	};
+
+	/** @return The bin index of a positive value. */
+	static int32 GetIndex(double Value);
+
+	/** @return The representative value of a bin. */
+	static double GetValue(int32 Index);
+
+	/** The bins of positive values. */
+	FStore Positive;
+
+	/** The bins of the magnitudes of negative values. */
+	FStore Negative;
+
+	/** The number of values too close to zero to be binned. */
+	uint64 ZeroCount = 0;
+
+	/** The number of infinite values of each sign, which are ranked but never binned. */
+	uint64 NegativeInfinityCount = 0;
+	uint64 PositiveInfinityCount = 0;
+
+	/** The number of NaNs, which have no rank. */
+	uint64 NaNCount = 0;
+
+	uint64 Count = 0;
+	double Min = TNumericLimits<double>::Max();
+	double Max = TNumericLimits<double>::Lowest();
+};
+
+/**
+ * @class FLoggerQuantiles
+ * @brief Feeds logged values into per‑thread sketches and reports merged percentiles per interval.
+ */
+class FLoggerQuantiles
+{
+public:
+	/** @return True if logged floats are being fed into sketches instead of logged as text. */
+	static bool IsEnabled() { return bEnabled; }
+
+	/**
+	 * @brief Enables or disables the sketches, reporting anything collected so far when disabling.
+	 *
+	 * @param bInEnabled		Whether to feed logged floats into sketches.
+	 * @param InFlushInterval	The number of seconds between reports. Zero only reports on demand.
+	 */
+	static void Configure(bool bInEnabled, float InFlushInterval);
+
+	/**
+	 * @brief Adds a value to the calling thread's sketch for the given key.
+	 *
+	 * @param Key	The key of the sketch.
+	 * @param Value	The value to add.
+	 */
+	static void Add(const FString& Key, double Value);
+
+	/**
+	 * @brief Reports if the flush interval has elapsed.
+	 *
+	 * @param DeltaTime The number of seconds since the last tick.
+	 */
+	static void Tick(float DeltaTime);
+
+	/**
+	 * @brief Merges every thread's sketches, logs p50/p90/p99/max per key and starts a new interval.
+	 */
+	static void Flush();
+
+private:
+	/** Whether logged floats are fed into sketches. */
+	inline static bool bEnabled = false;
+
+	inline static float FlushInterval = 10.f;
+	inline static float TimeSinceFlush = 0.f;
+};
@@ -0,0 +1,198 @@
+/**
+ * @file		LoggerSessionStats.cpp
+ * @brief		Counts what the logging utilities did over a session and reports it as JSON.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerSessionStats.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "LoggerBuiltinSinks.h"
+#include "LoggerHeavyHitters.h"
+#include "LoggerLog.h"
+#include "LoggerPerThread.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include <atomic>
+
+// The number of entries of each top list included in the summary.
+static constexpr int32 SummaryTopNum = 10;
+
+// The number of logger levels.
+static constexpr int32 NumLevels = static_cast<int32>(ELoggerLevel::Fatal) + 1;
+
+static FAutoConsoleCommand CmdSummary(
+	TEXT("gronk.log.Summary"),
+	TEXT("Writes a JSON summary of the logging utilities' session so far. Usage: gronk.log.Summary [FilePath]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FLoggerSessionStats::WriteSummary(Args.Num() > 0 ? Args[0] : FString());
+	}));
+
+/**
+ * @struct FLoggerSessionCounters
+ * @brief The counters of one thread. Only written by their thread, and read by the report.
+ */
+struct FLoggerSessionCounters
+{
+	std::atomic<uint64> RecordsPerLevel[NumLevels] = {};
+	std::atomic<uint64> SuppressedPerGate[static_cast<int32>(ELoggerGate::Num)] = {};
+	std::atomic<uint64> BytesFormatted { 0 };
+	std::atomic<uint64> Cycles { 0 };
+	std::atomic<uint64> OnScreenMessages { 0 };
+	std::atomic<uint64> Drops { 0 };
+};
+
+/**
+ * @brief Adds to a counter only ever written by the calling thread.
+ *
+ * @param Counter	The counter to add to.
+ * @param Amount	The amount to add.
+ */
+static FORCEINLINE void AddLocal(std::atomic<uint64>& Counter, uint64 Amount = 1)
+{
+	Counter.store(Counter.load(std::memory_order_relaxed) + Amount, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Converts a top list into a JSON array.
+ *
+ * @param Entries	The names and counts of the entries.
+ * @param KeyName	The field name of the entry names.
+ * @return The JSON array.
+ */
+static TArray<TSharedPtr<FJsonValue>> MakeTopArray(const TArray<TPair<FString, uint64>>& Entries, const TCHAR* KeyName)
+{
+	TArray<TSharedPtr<FJsonValue>> Array;
+	for (const TPair<FString, uint64>& Entry : Entries)
+	{
+		TSharedRef<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+		EntryObject->SetStringField(KeyName, Entry.Key);
+		EntryObject->SetNumberField(TEXT("count"), static_cast<double>(Entry.Value));
+		Array.Add(MakeShared<FJsonValueObject>(EntryObject));
+	}
+	return Array;
+}
+
+void FLoggerSessionStats::RecordEmitted(ELoggerLevel Level, uint64 BytesFormatted, uint64 Cycles)
+{
+	FLoggerSessionCounters& Counters = TLoggerPerThread<FLoggerSessionCounters>::GetLocal();
+	AddLocal(Counters.RecordsPerLevel[FMath::Min(static_cast<int32>(Level), NumLevels - 1)]);
+	AddLocal(Counters.BytesFormatted, BytesFormatted);
+	AddLocal(Counters.Cycles, Cycles);
+}
+
+void FLoggerSessionStats::RecordSuppressed(ELoggerGate Gate)
+{
+	AddLocal(TLoggerPerThread<FLoggerSessionCounters>::GetLocal().SuppressedPerGate[static_cast<int32>(Gate)]);
+}
+
+void FLoggerSessionStats::RecordOnScreen()
+{
+	AddLocal(TLoggerPerThread<FLoggerSessionCounters>::GetLocal().OnScreenMessages);
+}
+
+void FLoggerSessionStats::RecordDrop()
+{
+	AddLocal(TLoggerPerThread<FLoggerSessionCounters>::GetLocal().Drops);
+}
+
+void FLoggerSessionStats::StartSession()
+{
+	StartTime = FPlatformTime::Seconds();
+}
+
+FString FLoggerSessionStats::WriteSummary(const FString& FilePath)
+{
+	// Merge the counters of every thread.
+	uint64 RecordsPerLevel[NumLevels] = {};
+	uint64 SuppressedPerGate[static_cast<int32>(ELoggerGate::Num)] = {};
+	uint64 BytesFormatted = 0;
+	uint64 Cycles = 0;
+	uint64 OnScreenMessages = 0;
+	uint64 Drops = 0;
+
+	TLoggerPerThread<FLoggerSessionCounters>::ForEach([&](FLoggerSessionCounters& Counters)
+	{
+		for (int32 LevelIndex = 0; LevelIndex < NumLevels; ++LevelIndex)
+		{
+			RecordsPerLevel[LevelIndex] += Counters.RecordsPerLevel[LevelIndex].load(std::memory_order_relaxed);
+		}
+		for (int32 GateIndex = 0; GateIndex < static_cast<int32>(ELoggerGate::Num); ++GateIndex)
+		{
+			SuppressedPerGate[GateIndex] += Counters.SuppressedPerGate[GateIndex].load(std::memory_order_relaxed);
+		}
+		BytesFormatted += Counters.BytesFormatted.load(std::memory_order_relaxed);
+		Cycles += Counters.Cycles.load(std::memory_order_relaxed);
+		OnScreenMessages += Counters.OnScreenMessages.load(std::memory_order_relaxed);
+		Drops += Counters.Drops.load(std::memory_order_relaxed);
+	});
+
+	TSharedRef<FJsonObject> Summary = MakeShared<FJsonObject>();
+	const double SessionSeconds = FPlatformTime::Seconds() - StartTime;
+	Summary->SetNumberField(TEXT("sessionSeconds"), SessionSeconds);
+
+	TSharedRef<FJsonObject> Records = MakeShared<FJsonObject>();
+	const UEnum* LevelEnum = StaticEnum<ELoggerLevel>();
+	for (int32 LevelIndex = 0; LevelIndex < NumLevels; ++LevelIndex)
+	{
+		Records->SetNumberField(LevelEnum->GetNameStringByValue(LevelIndex), static_cast<double>(RecordsPerLevel[LevelIndex]));
+	}
+	Summary->SetObjectField(TEXT("records"), Records);
+
+	TSharedRef<FJsonObject> Suppressed = MakeShared<FJsonObject>();
+	for (int32 GateIndex = 0; GateIndex < static_cast<int32>(ELoggerGate::Num); ++GateIndex)
+	{
+		Suppressed->SetNumberField(GetGateName(static_cast<ELoggerGate>(GateIndex)), static_cast<double>(SuppressedPerGate[GateIndex]));
+	}
+	Summary->SetObjectField(TEXT("suppressed"), Suppressed);
+
+	Summary->SetNumberField(TEXT("bytesFormatted"), static_cast<double>(BytesFormatted));
+	Summary->SetNumberField(TEXT("secondsInLogger"), FPlatformTime::ToSeconds64(Cycles));
+	Summary->SetNumberField(TEXT("onScreenMessages"), static_cast<double>(OnScreenMessages));
+	Summary->SetNumberField(TEXT("drops"), static_cast<double>(Drops));
+
+	const FLoggerFileWriteStats FileStats = FLoggerFileSink::GetWriteStats();
+	TSharedRef<FJsonObject> FileWrites = MakeShared<FJsonObject>();
+	FileWrites->SetNumberField(TEXT("syscalls"), static_cast<double>(FileStats.Syscalls));
+	FileWrites->SetNumberField(TEXT("syscallsPerSecond"), SessionSeconds > 0.0 ? FileStats.Syscalls / SessionSeconds : 0.0);
+	FileWrites->SetNumberField(TEXT("records"), static_cast<double>(FileStats.Records));
+	FileWrites->SetNumberField(TEXT("bytes"), static_cast<double>(FileStats.Bytes));
+	Summary->SetObjectField(TEXT("fileWrites"), FileWrites);
+	Summary->SetArrayField(TEXT("topCallSites"), MakeTopArray(FLoggerHeavyHitters::GetTopCallSites(SummaryTopNum), TEXT("callSite")));
+	Summary->SetArrayField(TEXT("topCallers"), MakeTopArray(FLoggerHeavyHitters::GetTopCallers(SummaryTopNum), TEXT("caller")));
+
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Summary, Writer);
+
+	const FString OutputPath = !FilePath.IsEmpty()
+		? FilePath
+		: FPaths::Combine(FPaths::ProjectLogDir(), TEXT("GronkUtils"), FString::Printf(TEXT("Session-%s.json"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"))));
+
+	if (!FFileHelper::SaveStringToFile(Json, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogLoggerLibrary, Warning, TEXT("Failed to write the logging session summary to %s"), *OutputPath);
+		return FString();
+	}
+
+	UE_LOG(LogLoggerLibrary, Display, TEXT("Wrote the logging session summary to %s"), *OutputPath);
+	return OutputPath;
+}
+
+const TCHAR* FLoggerSessionStats::GetGateName(ELoggerGate Gate)
+{
+	switch (Gate)
+	{
+		case ELoggerGate::Level:		return TEXT("level");
+		case ELoggerGate::Condition:	return TEXT("condition");
+		case ELoggerGate::Once:			return TEXT("once");
+		case ELoggerGate::NetMode:		return TEXT("netMode");
+		case ELoggerGate::Quota:		return TEXT("quota");
+		default:						return TEXT("unknown");
+	}
+}
@@ -0,0 +1,91 @@
+/**
+ * @file		LoggerSessionStats.h
+ * @brief		Counts what the logging utilities did over a session and reports it as JSON.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoggerLibrary.h"
+
+/**
+ * @enum ELoggerGate
+ * @brief The checks that can stop a record from being emitted.
+ */
+enum class ELoggerGate : uint8
+{
+	/** The level is suppressed by the output log and below the on‑screen level. */
+	Level,
+
+	/** The condition of "Log On Validity" or "Log On Condition" did not call for a log. */
+	Condition,
+
+	/** A "Log Once" call site already logged. */
+	Once,
+
+	/** The caller's net mode or role is filtered out. */
+	NetMode,
+
+	/** The caller's actor used up its quota for the second. */
+	Quota,
+
+	Num
+};
+
+/**
+ * @class FLoggerSessionStats
+ * @brief Keeps per‑thread counters of the session's logging and merges them into a report.
+ *
+ * Each thread only writes its own relaxed atomics, so counting costs no locks or shared cache
+ * lines. The report is written at shutdown, by "gronk.log.Summary", or from Blueprint.
+ */
+class FLoggerSessionStats
+{
+public:
+	/**
+	 * @brief Counts an emitted record.
+	 *
+	 * @param Level				Log level of the record.
+	 * @param BytesFormatted	The size of the formatted record.
+	 * @param Cycles			The number of cycles spent emitting the record.
+	 */
+	static void RecordEmitted(ELoggerLevel Level, uint64 BytesFormatted, uint64 Cycles);
+
+	/**
+	 * @brief Counts a record stopped by a gate.
+	 *
+	 * @param Gate The gate that stopped the record.
+	 */
+	static void RecordSuppressed(ELoggerGate Gate);
+
+	/**
+	 * @brief Counts a message shown on screen.
+	 */
+	static void RecordOnScreen();
+
+	/**
+	 * @brief Counts a record that was lost after being emitted, e.g. by a full queue.
+	 */
+	static void RecordDrop();
+
+	/**
+	 * @brief Marks the start of the session.
+	 */
+	static void StartSession();
+
+	/**
+	 * @brief Merges every thread's counters and writes the session summary.
+	 *
+	 * @param FilePath The file to write, or empty for Saved/Logs/GronkUtils/Session-<timestamp>.json.
+	 * @return The path of the written file, or empty if it could not be written.
+	 */
+	static FString WriteSummary(const FString& FilePath = FString());
+
+	/** @return The name of a gate, as used in the report. */
+	static const TCHAR* GetGateName(ELoggerGate Gate);
+
+private:
+	/** The time the session started, in seconds. */
+	inline static double StartTime = 0.0;
+};
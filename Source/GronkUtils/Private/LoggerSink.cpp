@@ -0,0 +1,266 @@
+/**
+ * @file		LoggerSink.cpp
+ * @brief		The outputs of the logger library and the records they receive.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerSink.h"
+#include "LoggerBuiltinSinks.h"
+#include "LoggerLog.h"
+#include "LoggerPerThread.h"
+#include "LoggerSqliteSink.h"
+#include "LoggerUtf8.h"
+#include "Misc/ScopeRWLock.h"
+#include <atomic>
+
+// The number of built‑in outputs.
+static constexpr int32 NumOutputs = static_cast<int32>(ELoggerOutput::Sqlite) + 1;
+
+/**
+ * @struct FLoggerSinkRegistry
+ * @brief The registered sinks and the union of the representations they consume.
+ */
+struct FLoggerSinkRegistry
+{
+	FRWLock Lock;
+	TArray<TSharedRef<ILoggerSink, ESPMode::ThreadSafe>> Sinks;
+	ELoggerRepresentation Representations = ELoggerRepresentation::None;
+
+	/** The sink of each built‑in output, created when the output is first enabled. */
+	TSharedPtr<ILoggerSink, ESPMode::ThreadSafe> OutputSinks[NumOutputs];
+
+	FLoggerSinkRegistry()
+	{
+		EnableOutput(ELoggerOutput::OutputLog);
+		EnableOutput(ELoggerOutput::OnScreen);
+	}
+
+	/** Adds the sink of a built‑in output. Must be called with the lock held for writing. */
+	void EnableOutput(ELoggerOutput Output)
+	{
+		TSharedPtr<ILoggerSink, ESPMode::ThreadSafe>& OutputSink = OutputSinks[static_cast<int32>(Output)];
+		if (!OutputSink)
+		{
+			switch (Output)
+			{
+				case ELoggerOutput::OutputLog:	OutputSink = MakeShared<FLoggerOutputLogSink, ESPMode::ThreadSafe>(); break;
+				case ELoggerOutput::OnScreen:	OutputSink = MakeShared<FLoggerOnScreenSink, ESPMode::ThreadSafe>(); break;
+				case ELoggerOutput::File:		OutputSink = MakeShared<FLoggerFileSink, ESPMode::ThreadSafe>(ELoggerRepresentation::Utf8Line, TEXT("log")); break;
+				case ELoggerOutput::Json:		OutputSink = MakeShared<FLoggerFileSink, ESPMode::ThreadSafe>(ELoggerRepresentation::JsonLine, TEXT("jsonl")); break;
+#if WITH_GRONK_SQLITE
+				case ELoggerOutput::Sqlite:		OutputSink = MakeShared<FLoggerSqliteSink, ESPMode::ThreadSafe>(); break;
+#else
+				case ELoggerOutput::Sqlite:		break;
+#endif
+			}
+		}
+		if (!OutputSink)
+		{
+			UE_LOG(LogLoggerLibrary, Warning, TEXT("The %s output is unavailable in this build."), *UEnum::GetDisplayValueAsText(Output).ToString());
+			return;
+		}
+		Sinks.AddUnique(OutputSink.ToSharedRef());
+		UpdateRepresentations();
+	}
+
+	/** Recomputes the union of representations. Must be called with the lock held for writing. */
+	void UpdateRepresentations()
+	{
+		Representations = ELoggerRepresentation::None;
+		for (const TSharedRef<ILoggerSink, ESPMode::ThreadSafe>& Sink : Sinks)
+		{
+			Representations |= Sink->GetRepresentations();
+		}
+	}
+};
+
+/**
+ * @struct FLoggerDispatchCounters
+ * @brief The dispatch totals of one thread. Only written by their thread.
+ */
+struct FLoggerDispatchCounters
+{
+	std::atomic<uint64> Records { 0 };
+	std::atomic<uint64> BytesFormatted { 0 };
+};
+
+/** @return The sink registry. */
+static FLoggerSinkRegistry& GetRegistry()
+{
+	static FLoggerSinkRegistry Registry;
+	return Registry;
+}
+
+/**
+ * @brief Appends a string to a JSON document as a quoted, escaped string.
+ *
+ * @param Json	The JSON document.
+ * @param Value	The string to append.
+ */
+static void AppendJsonString(FString& Json, const FString& Value)
+{
+	Json.AppendChar(TEXT('"'));
+	for (const TCHAR Char : Value)
+	{
+		switch (Char)
+		{
+			case TEXT('"'):		Json.Append(TEXT("\\\"")); break;
+			case TEXT('\\'):	Json.Append(TEXT("\\\\")); break;
+			case TEXT('\n'):	Json.Append(TEXT("\\n")); break;
+			case TEXT('\r'):	Json.Append(TEXT("\\r")); break;
+			case TEXT('\t'):	Json.Append(TEXT("\\t")); break;
+			default:
+				if (Char < 0x20)
+				{
+					Json.Appendf(TEXT("\\u%04x"), static_cast<uint32>(Char));
+				}
+				else
+				{
+					Json.AppendChar(Char);
+				}
+				break;
+		}
+	}
+	Json.AppendChar(TEXT('"'));
+}
+
+void FLoggerSinks::AddSink(const TSharedRef<ILoggerSink, ESPMode::ThreadSafe>& Sink)
+{
+	FLoggerSinkRegistry& Registry = GetRegistry();
+	FWriteScopeLock ScopeLock(Registry.Lock);
+	Registry.Sinks.AddUnique(Sink);
+	Registry.UpdateRepresentations();
+}
+
+void FLoggerSinks::RemoveSink(const TSharedRef<ILoggerSink, ESPMode::ThreadSafe>& Sink)
+{
+	Sink->Flush();
+
+	FLoggerSinkRegistry& Registry = GetRegistry();
+	FWriteScopeLock ScopeLock(Registry.Lock);
+	Registry.Sinks.Remove(Sink);
+	Registry.UpdateRepresentations();
+}
+
+void FLoggerSinks::SetOutputEnabled(ELoggerOutput Output, bool bEnabled)
+{
+	FLoggerSinkRegistry& Registry = GetRegistry();
+	if (bEnabled)
+	{
+		FWriteScopeLock ScopeLock(Registry.Lock);
+		Registry.EnableOutput(Output);
+	}
+	else if (const TSharedPtr<ILoggerSink, ESPMode::ThreadSafe>& OutputSink = Registry.OutputSinks[static_cast<int32>(Output)])
+	{
+		RemoveSink(OutputSink.ToSharedRef());
+	}
+}
+
+uint64 FLoggerSinks::Dispatch(const FLoggerRecord& Record)
+{
+	FLoggerSinkRegistry& Registry = GetRegistry();
+	FReadScopeLock ScopeLock(Registry.Lock);
+
+	const ELoggerRepresentation Needed = Registry.Representations;
+	FLoggerFormattedRecord Formatted;
+	uint64 BytesFormatted = 0;
+
+	// Format each representation at most once. Lines are assembled from the cached prefix, so the
+	// only per record work is copying the message.
+	if (EnumHasAnyFlags(Needed, ELoggerRepresentation::Text))
+	{
+		FString Text;
+		Text.Reserve(Record.Prefix.Len() + Record.Message.Len());
+		Text.Append(Record.Prefix);
+		Text.Append(Record.Message);
+
+		Formatted.Text = MakeShared<FString, ESPMode::ThreadSafe>(MoveTemp(Text));
+		BytesFormatted += Formatted.Text->Len() * sizeof(TCHAR);
+	}
+	if (EnumHasAnyFlags(Needed, ELoggerRepresentation::Utf8Line))
+	{
+		TArray<uint8> Bytes;
+		Bytes.Reserve(Record.Utf8Prefix.Num() + Record.Message.Len() + 1);
+		Bytes.Append(Record.Utf8Prefix);
+		FLoggerUtf8::Append(Bytes, *Record.Message, Record.Message.Len(), 1);
+		Bytes.Add('\n');
+
+		Formatted.Utf8Line = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(MoveTemp(Bytes));
+		BytesFormatted += Formatted.Utf8Line->Num();
+	}
+	if (EnumHasAnyFlags(Needed, ELoggerRepresentation::JsonLine))
+	{
+		FString Json;
+		Json.Reserve(80 + Record.NetLabel.Len() + Record.ContextName.Len() + Record.Message.Len());
+		Json.Append(TEXT("{\"time\":\""));
+		Json.Append(Record.Time.ToIso8601());
+		Json.Append(TEXT("\",\"level\":\""));
+		Json.Append(StaticEnum<ELoggerLevel>()->GetNameStringByValue(static_cast<int64>(Record.Level)));
+		Json.Append(TEXT("\",\"net\":"));
+		AppendJsonString(Json, Record.NetLabel);
+		Json.Append(TEXT(",\"context\":"));
+		AppendJsonString(Json, Record.ContextName);
+		Json.Append(TEXT(",\"message\":"));
+		AppendJsonString(Json, Record.Message);
+		Json.AppendChar(TEXT('}'));
+
+		Formatted.JsonLine = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(FLoggerUtf8::ToLine(Json));
+		BytesFormatted += Formatted.JsonLine->Num();
+	}
+
+	for (const TSharedRef<ILoggerSink, ESPMode::ThreadSafe>& Sink : Registry.Sinks)
+	{
+		Sink->Write(Record, Formatted);
+	}
+
+	FLoggerDispatchCounters& Counters = TLoggerPerThread<FLoggerDispatchCounters>::GetLocal();
+	Counters.Records.store(Counters.Records.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	Counters.BytesFormatted.store(Counters.BytesFormatted.load(std::memory_order_relaxed) + BytesFormatted, std::memory_order_relaxed);
+
+	return BytesFormatted;
+}
+
+FLoggerDispatchStats FLoggerSinks::GetDispatchStats()
+{
+	FLoggerDispatchStats Stats;
+	TLoggerPerThread<FLoggerDispatchCounters>::ForEach([&Stats](FLoggerDispatchCounters& Counters)
+	{
+		Stats.Records += Counters.Records.load(std::memory_order_relaxed);
+		Stats.BytesFormatted += Counters.BytesFormatted.load(std::memory_order_relaxed);
+	});
+	return Stats;
+}
+
+void FLoggerSinks::Tick(float DeltaTime)
+{
+	FLoggerSinkRegistry& Registry = GetRegistry();
+	FReadScopeLock ScopeLock(Registry.Lock);
+	for (const TSharedRef<ILoggerSink, ESPMode::ThreadSafe>& Sink : Registry.Sinks)
+	{
+		Sink->Tick(DeltaTime);
+	}
+}
+
+void FLoggerSinks::Flush()
+{
+	FLoggerSinkRegistry& Registry = GetRegistry();
+	FReadScopeLock ScopeLock(Registry.Lock);
+	for (const TSharedRef<ILoggerSink, ESPMode::ThreadSafe>& Sink : Registry.Sinks)
+	{
+		Sink->Flush();
+	}
+}
+
+void FLoggerSinks::Shutdown()
+{
+	Flush();
+
+	FLoggerSinkRegistry& Registry = GetRegistry();
+	FWriteScopeLock ScopeLock(Registry.Lock);
+	Registry.Sinks.Reset();
+	for (TSharedPtr<ILoggerSink, ESPMode::ThreadSafe>& OutputSink : Registry.OutputSinks)
+	{
+		OutputSink.Reset();
+	}
+	Registry.UpdateRepresentations();
+}
@@ -0,0 +1,163 @@
+/**
+ * @file		LoggerSpaceSaving.h
+ * @brief		A Space‑Saving top‑K tracker with constant time updates.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @class TLoggerSpaceSaving
+ * @brief Tracks the most frequent keys of a stream in a fixed number of counters.
+ *
+ * Counters are kept sorted by count, and the first position of every distinct count is indexed,
+ * so an increment is a single swap to the front of its group. When all counters are taken, a new
+ * key replaces the least frequent one and inherits its count as the error bound. Not thread safe.
+ *
+ * @tparam KeyType The type of the tracked keys. Must be hashable.
+ */
+template <typename KeyType>
+class TLoggerSpaceSaving
+{
+public:
+	/**
+	 * @struct FCounter
+	 * @brief A tracked key and its estimated count.
+	 */
+	struct FCounter
+	{
+		KeyType Key;
+
+		/** The estimated count, which overestimates the true count by at most Error. */
+		uint64 Count = 0;
+
+		/** The count of the key this counter replaced. */
+		uint64 Error = 0;
+	};
+
+	/**
+	 * @param InCapacity The number of counters to keep.
+	 */
+	explicit TLoggerSpaceSaving(int32 InCapacity)
+		: Capacity(FMath::Max(InCapacity, 1))
+	{
+		Counters.Reserve(Capacity);
+		Positions.Reserve(Capacity);
+	}
+
+	/**
+	 * @brief Counts one occurrence of a key.
+	 *
+	 * @param Key The key that occurred.
+	 */
+	void Add(const KeyType& Key)
+	{
+		if (const int32* Position = Positions.Find(Key))
+		{
+			Increment(*Position);
+			return;
+		}
+
+		if (Counters.Num() < Capacity)
+		{
+			const int32 Position = Counters.Num();
+			Counters.Add({ Key, 0, 0 });
+			Positions.Add(Key, Position);
+			if (Position == 0 || Counters[Position - 1].Count != 0)
+			{
+				GroupStarts.Add(0, Position);
+			}
+			Increment(Position);
+			return;
+		}
+
+		// Replace the least frequent key, which is always last.
+		const int32 Position = Counters.Num() - 1;
+		FCounter& Counter = Counters[Position];
+		Positions.Remove(Counter.Key);
+		Counter.Key = Key;
+		Counter.Error = Counter.Count;
+		Positions.Add(Key, Position);
+		Increment(Position);
+	}
+
+	/**
+	 * @brief Gets the most frequent keys.
+	 *
+	 * @param Num The maximum number of keys to get.
+	 * @return The counters of the most frequent keys, most frequent first.
+	 */
+	TArray<FCounter> GetTop(int32 Num) const
+	{
+		return TArray<FCounter>(Counters.GetData(), FMath::Min(Num, Counters.Num()));
+	}
+
+	/** @return The total number of occurrences counted. */
+	uint64 GetTotal() const { return Total; }
+
+	/**
+	 * @brief Forgets every key.
+	 */
+	void Reset()
+	{
+		Counters.Reset();
+		Positions.Reset();
+		GroupStarts.Reset();
+		Total = 0;
+	}
+
+private:
+	/**
+	 * @brief Increments the counter at a position, keeping the counters sorted.
+	 *
+	 * @param Position The position of the counter.
+	 */
+	void Increment(int32 Position)
+	{
+		++Total;
+
+		const uint64 OldCount = Counters[Position].Count;
+		const int32 GroupStart = GroupStarts.FindChecked(OldCount);
+
+		// Move the counter to the front of its group, where it borders the next larger count.
+		if (GroupStart != Position)
+		{
+			Swap(Counters[GroupStart], Counters[Position]);
+			Positions[Counters[Position].Key] = Position;
+			Positions[Counters[GroupStart].Key] = GroupStart;
+		}
+
+		const uint64 NewCount = ++Counters[GroupStart].Count;
+
+		if (GroupStart + 1 < Counters.Num() && Counters[GroupStart + 1].Count == OldCount)
+		{
+			GroupStarts[OldCount] = GroupStart + 1;
+		}
+		else
+		{
+			GroupStarts.Remove(OldCount);
+		}
+
+		if (!GroupStarts.Contains(NewCount))
+		{
+			GroupStarts.Add(NewCount, GroupStart);
+		}
+	}
+
+	/** The number of counters to keep. */
+	int32 Capacity;
+
+	/** The counters, sorted from most to least frequent. */
+	TArray<FCounter> Counters;
+
+	/** The position of each tracked key in Counters. */
+	TMap<KeyType, int32> Positions;
+
+	/** The first position of each distinct count in Counters. */
+	TMap<uint64, int32> GroupStarts;
+
+	/** The total number of occurrences counted. */
+	uint64 Total = 0;
+};
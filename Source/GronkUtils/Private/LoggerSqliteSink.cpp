@@ -0,0 +1,247 @@
+/**
+ * @file		LoggerSqliteSink.cpp
+ * @brief		Writes records to a SQLite database for querying sessions with SQL.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerSqliteSink.h"
+
+#if WITH_GRONK_SQLITE
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "LoggerLog.h"
+#include "LoggerSessionStats.h"
+#include "Misc/App.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+static int32 SqliteBatchSize = 4096;
+static FAutoConsoleVariableRef CVarSqliteBatchSize(
+	TEXT("gronk.log.Sqlite.BatchSize"),
+	SqliteBatchSize,
+	TEXT("The most rows the SQLite sink inserts per transaction, and the number of queued rows that wakes its thread."));
+
+static float SqliteFlushInterval = 1.f;
+static FAutoConsoleVariableRef CVarSqliteFlushInterval(
+	TEXT("gronk.log.Sqlite.FlushInterval"),
+	SqliteFlushInterval,
+	TEXT("The maximum number of seconds records wait in the SQLite sink before they are inserted."));
+
+static int32 SqliteMaxPending = 256 * 1024;
+static FAutoConsoleVariableRef CVarSqliteMaxPending(
+	TEXT("gronk.log.Sqlite.MaxPending"),
+	SqliteMaxPending,
+	TEXT("The most rows the SQLite sink queues. Records beyond it are dropped until its thread catches up."));
+
+FLoggerSqliteSink::FLoggerSqliteSink()
+{
+	const FString FileName = FString::Printf(TEXT("%s-%s.sqlite3"), FApp::GetProjectName(), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+	FilePath = FPaths::Combine(FPaths::ProjectLogDir(), TEXT("GronkUtils"), FileName);
+
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	CommitEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	Thread = FRunnableThread::Create(this, TEXT("GronkLogSqliteSink"), 0, TPri_BelowNormal);
+
+	// Without a thread nothing would ever drain the queue, e.g. with -nothreading.
+	if (!Thread)
+	{
+		UE_LOG(LogLoggerLibrary, Error, TEXT("Failed to start the thread of the log database %s. Its records will be dropped."), *FilePath);
+		bFailed = true;
+	}
+}
+
+FLoggerSqliteSink::~FLoggerSqliteSink()
+{
+	bStopping = true;
+	WakeEvent->Trigger();
+	if (Thread)
+	{
+		Thread->WaitForCompletion();
+		delete Thread;
+	}
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	FPlatformProcess::ReturnSynchEventToPool(CommitEvent);
+}
+
+void FLoggerSqliteSink::Write(const FLoggerRecord& Record, const FLoggerFormattedRecord& Formatted)
+{
+	if (bFailed.load(std::memory_order_relaxed))
+	{
+		FLoggerSessionStats::RecordDrop();
+		return;
+	}
+
+	// Bound the queue if the background thread falls behind, dropping records like the file sinks do.
+	bool bQueued = false;
+	int32 NumPending;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (Pending.Num() < FMath::Max(SqliteMaxPending, 1))
+		{
+			Pending.Add({ Record.Time, Record.Level, Record.NetLabel, Record.ContextName, Record.Message });
+			bQueued = true;
+		}
+		NumPending = Pending.Num();
+	}
+
+	if (!bQueued)
+	{
+		FLoggerSessionStats::RecordDrop();
+		WakeEvent->Trigger();
+		return;
+	}
+	NumQueued.fetch_add(1, std::memory_order_relaxed);
+
+	if (NumPending >= SqliteBatchSize)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FLoggerSqliteSink::Flush()
+{
+	if (!Thread)
+	{
+		return;
+	}
+
+	// Wait until everything queued before the call is committed.
+	const uint64 Target = NumQueued.load();
+	while (NumDone.load() < Target && !bFailed.load())
+	{
+		WakeEvent->Trigger();
+		CommitEvent->Wait(100);
+	}
+}
+
+uint32 FLoggerSqliteSink::Run()
+{
+	if (!OpenDatabase())
+	{
+		bFailed = true;
+		FScopeLock ScopeLock(&Lock);
+		for (int32 Index = 0; Index < Pending.Num(); ++Index)
+		{
+			FLoggerSessionStats::RecordDrop();
+		}
+		Pending.Empty();
+		CommitEvent->Trigger();
+		return 1;
+	}
+
+	while (!bStopping)
+	{
+		WakeEvent->Wait(FMath::Max(FMath::RoundToInt(SqliteFlushInterval * 1000.f), 1));
+		InsertPending();
+	}
+
+	InsertPending();
+	CloseDatabase();
+	return 0;
+}
+
+bool FLoggerSqliteSink::OpenDatabase()
+{
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+	if (!Database.Open(*FilePath, ESQLiteDatabaseOpenMode::ReadWriteCreate))
+	{
+		UE_LOG(LogLoggerLibrary, Error, TEXT("Failed to open the log database %s: %s"), *FilePath, *Database.GetLastError());
+		return false;
+	}
+
+	// WAL lets analysts read a session while it is being written, and NORMAL only syncs at checkpoints.
+	const bool bCreated = Database.Execute(TEXT("PRAGMA journal_mode=WAL;"))
+		&& Database.Execute(TEXT("PRAGMA synchronous=NORMAL;"))
+		&& Database.Execute(TEXT("CREATE TABLE IF NOT EXISTS records (id INTEGER PRIMARY KEY, time TEXT NOT NULL, level TEXT NOT NULL, net TEXT NOT NULL, context TEXT NOT NULL, message TEXT NOT NULL);"));
+
+	if (bCreated)
+	{
+		InsertStatement = Database.PrepareStatement(TEXT("INSERT INTO records (time, level, net, context, message) VALUES (?1, ?2, ?3, ?4, ?5);"), ESQLitePreparedStatementFlags::Persistent);
+	}
+
+	if (!bCreated || !InsertStatement.IsValid())
+	{
+		UE_LOG(LogLoggerLibrary, Error, TEXT("Failed to set up the log database %s: %s"), *FilePath, *Database.GetLastError());
+		InsertStatement.Destroy();
+		Database.Close();
+		return false;
+	}
+
+	return true;
+}
+
+void FLoggerSqliteSink::InsertPending()
+{
+	TArray<FLoggerSqliteRow> Rows;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Swap(Rows, Pending);
+	}
+	if (Rows.IsEmpty())
+	{
+		CommitEvent->Trigger();
+		return;
+	}
+
+	const UEnum* LevelEnum = StaticEnum<ELoggerLevel>();
+	const int32 BatchSize = FMath::Max(SqliteBatchSize, 1);
+
+	for (int32 BatchStart = 0; BatchStart < Rows.Num(); BatchStart += BatchSize)
+	{
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, Rows.Num());
+
+		// Rows that fail to insert are dropped on their own, so the rest of the batch still commits.
+		int32 NumInserted = 0;
+		Database.Execute(TEXT("BEGIN;"));
+		for (int32 Index = BatchStart; Index < BatchEnd; ++Index)
+		{
+			const FLoggerSqliteRow& Row = Rows[Index];
+			InsertStatement.SetBindingValueByIndex(1, Row.Time.ToIso8601());
+			InsertStatement.SetBindingValueByIndex(2, LevelEnum->GetNameStringByValue(static_cast<int64>(Row.Level)));
+			InsertStatement.SetBindingValueByIndex(3, Row.NetLabel);
+			InsertStatement.SetBindingValueByIndex(4, Row.ContextName);
+			InsertStatement.SetBindingValueByIndex(5, Row.Message);
+			if (InsertStatement.Execute())
+			{
+				++NumInserted;
+			}
+			else
+			{
+				FLoggerSessionStats::RecordDrop();
+			}
+			InsertStatement.Reset();
+		}
+
+		// A rolled back batch loses every row that was inserted into it.
+		if (!Database.Execute(TEXT("COMMIT;")))
+		{
+			UE_LOG(LogLoggerLibrary, Warning, TEXT("Failed to commit %d records to the log database: %s"), NumInserted, *Database.GetLastError());
+			Database.Execute(TEXT("ROLLBACK;"));
+			for (int32 Index = 0; Index < NumInserted; ++Index)
+			{
+				FLoggerSessionStats::RecordDrop();
+			}
+		}
+
+		NumDone.fetch_add(BatchEnd - BatchStart);
+		CommitEvent->Trigger();
+	}
+}
+
+void FLoggerSqliteSink::CloseDatabase()
+{
+	InsertStatement.Destroy();
+
+	// Building the indexes once over the whole session is far cheaper than maintaining them per insert.
+	Database.Execute(TEXT("CREATE INDEX IF NOT EXISTS records_time ON records (time);"));
+	Database.Execute(TEXT("CREATE INDEX IF NOT EXISTS records_level ON records (level);"));
+	Database.Execute(TEXT("CREATE INDEX IF NOT EXISTS records_context ON records (context);"));
+	Database.Execute(TEXT("PRAGMA wal_checkpoint(TRUNCATE);"));
+	Database.Close();
+}
+
+#endif // WITH_GRONK_SQLITE
@@ -0,0 +1,113 @@
+/**
+ * @file		LoggerSqliteSink.h
+ * @brief		Writes records to a SQLite database for querying sessions with SQL.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_GRONK_SQLITE
+
+#include "HAL/Runnable.h"
+#include "LoggerSink.h"
+#include "SQLiteDatabase.h"
+#include "SQLitePreparedStatement.h"
+#include <atomic>
+
+class FRunnableThread;
+
+/**
+ * @struct FLoggerSqliteRow
+ * @brief A record copied out of the dispatch, waiting to be inserted.
+ */
+struct FLoggerSqliteRow
+{
+	FDateTime Time;
+	ELoggerLevel Level;
+	FString NetLabel;
+	FString ContextName;
+	FString Message;
+};
+
+/**
+ * @class FLoggerSqliteSink
+ * @brief Inserts records into the "records" table of a database in Saved/Logs/GronkUtils.
+ *
+ * Logging threads only copy records into a queue. A background thread owns the database, which
+ * runs in WAL mode, and inserts the queue with one prepared statement in transactions of up to
+ * "gronk.log.Sqlite.BatchSize" rows. Indexes on time, level and context are created when the sink
+ * closes, after the bulk load, so inserts never pay to maintain them. The queue holds at most
+ * "gronk.log.Sqlite.MaxPending" rows, and records are dropped while it is full.
+ */
+class FLoggerSqliteSink : public ILoggerSink, private FRunnable
+{
+public:
+	FLoggerSqliteSink();
+	virtual ~FLoggerSqliteSink() override;
+
+	virtual ELoggerRepresentation GetRepresentations() const override { return ELoggerRepresentation::None; }
+	virtual void Write(const FLoggerRecord& Record, const FLoggerFormattedRecord& Formatted) override;
+	virtual void Flush() override;
+
+private:
+	//~ Begin FRunnable Interface
+	virtual uint32 Run() override;
+	//~ End FRunnable Interface
+
+	/**
+	 * @brief Opens the database, creates the table and prepares the insert statement.
+	 *
+	 * @return True if the database is ready for inserts.
+	 */
+	bool OpenDatabase();
+
+	/**
+	 * @brief Inserts every queued row, one transaction per batch.
+	 */
+	void InsertPending();
+
+	/**
+	 * @brief Creates the indexes analysts query by, and closes the database.
+	 */
+	void CloseDatabase();
+
+	/** The path of the database. */
+	FString FilePath;
+
+	/** The database. Only used by the background thread. */
+	FSQLiteDatabase Database;
+
+	/** The insert statement, reused for every row. Only used by the background thread. */
+	FSQLitePreparedStatement InsertStatement;
+
+	/** The rows waiting to be inserted. */
+	TArray<FLoggerSqliteRow> Pending;
+
+	/** Guards the pending rows. */
+	FCriticalSection Lock;
+
+	/** Wakes the background thread when a batch is ready, or to flush or stop. */
+	FEvent* WakeEvent = nullptr;
+
+	/** Signaled by the background thread whenever it commits. */
+	FEvent* CommitEvent = nullptr;
+
+	/** The background thread. */
+	FRunnableThread* Thread = nullptr;
+
+	/** The number of rows queued so far. */
+	std::atomic<uint64> NumQueued { 0 };
+
+	/** The number of rows committed or dropped so far. */
+	std::atomic<uint64> NumDone { 0 };
+
+	/** Set to stop the background thread. */
+	std::atomic<bool> bStopping { false };
+
+	/** Set if the thread could not start or the database could not be opened, after which records are dropped. */
+	std::atomic<bool> bFailed { false };
+};
+
+#endif // WITH_GRONK_SQLITE
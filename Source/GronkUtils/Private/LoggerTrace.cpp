@@ -0,0 +1,248 @@
+/**
+ * @file		LoggerTrace.cpp
+ * @brief		Captures the stream of logging calls into a compact trace for offline replay.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerTrace.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "LoggerLog.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+// The magic number at the start of every trace file.
+static constexpr uint32 TraceMagic = 0x31544C47; // "GLT1"
+
+// The version of the trace format.
+static constexpr uint32 TraceVersion = 1;
+
+// The tag byte of a string definition. Call tags never have the high bit set.
+static constexpr uint8 StringTag = 0xFF;
+
+static int32 TraceMaxBytes = 256 * 1024 * 1024;
+static FAutoConsoleVariableRef CVarTraceMaxBytes(
+	TEXT("gronk.log.Trace.MaxBytes"),
+	TraceMaxBytes,
+	TEXT("The size at which a logging trace stops recording calls."));
+
+static FAutoConsoleCommand CmdTraceStart(
+	TEXT("gronk.log.Trace.Start"),
+	TEXT("Starts capturing logging calls into a trace for replay. Usage: gronk.log.Trace.Start [FilePath]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FLoggerTrace::Start(Args.Num() > 0 ? Args[0] : FString());
+	}));
+
+static FAutoConsoleCommand CmdTraceStop(
+	TEXT("gronk.log.Trace.Stop"),
+	TEXT("Stops capturing logging calls and writes the trace."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FLoggerTrace::Stop();
+	}));
+
+/**
+ * @brief Appends an unsigned integer in LEB128 form.
+ *
+ * @param Bytes	The buffer to append to.
+ * @param Value	The integer.
+ */
+static void WriteVarInt(TArray<uint8>& Bytes, uint32 Value)
+{
+	while (Value >= 0x80)
+	{
+		Bytes.Add(static_cast<uint8>(Value | 0x80));
+		Value >>= 7;
+	}
+	Bytes.Add(static_cast<uint8>(Value));
+}
+
+/**
+ * @brief Reads an unsigned integer in LEB128 form.
+ *
+ * @param Bytes		The buffer to read from.
+ * @param Offset	The offset to read at, advanced past the integer.
+ * @param OutValue	The integer.
+ * @return True if a whole integer was read.
+ */
+static bool ReadVarInt(const TArray<uint8>& Bytes, int32& Offset, uint32& OutValue)
+{
+	OutValue = 0;
+	for (int32 Shift = 0; Shift < 35; Shift += 7)
+	{
+		if (Offset >= Bytes.Num())
+		{
+			return false;
+		}
+		const uint8 Byte = Bytes[Offset++];
+		OutValue |= static_cast<uint32>(Byte & 0x7F) << Shift;
+		if ((Byte & 0x80) == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FLoggerTrace::Start(const FString& FilePath)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (IsCapturing())
+	{
+		return false;
+	}
+
+	OutputPath = !FilePath.IsEmpty()
+		? FilePath
+		: FPaths::Combine(FPaths::ProjectLogDir(), TEXT("GronkUtils"), FString::Printf(TEXT("Trace-%s.gltrace"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"))));
+
+	Buffer.Reset();
+	StringIndices.Reset();
+	bTruncated = false;
+	LastCycles = FPlatformTime::Cycles64();
+
+	Buffer.Append(reinterpret_cast<const uint8*>(&TraceMagic), sizeof(TraceMagic));
+	Buffer.Append(reinterpret_cast<const uint8*>(&TraceVersion), sizeof(TraceVersion));
+
+	bCapturing.store(true, std::memory_order_relaxed);
+	UE_LOG(LogLoggerLibrary, Display, TEXT("Started capturing a logging trace to %s"), *OutputPath);
+	return true;
+}
+
+FString FLoggerTrace::Stop()
+{
+	FScopeLock ScopeLock(&Lock);
+	if (!IsCapturing())
+	{
+		return FString();
+	}
+	bCapturing.store(false, std::memory_order_relaxed);
+
+	if (bTruncated)
+	{
+		UE_LOG(LogLoggerLibrary, Warning, TEXT("The logging trace reached gronk.log.Trace.MaxBytes and is missing its last calls"));
+	}
+
+	const bool bSaved = FFileHelper::SaveArrayToFile(Buffer, *OutputPath);
+	Buffer.Empty();
+	StringIndices.Empty();
+
+	if (!bSaved)
+	{
+		UE_LOG(LogLoggerLibrary, Warning, TEXT("Failed to write the logging trace to %s"), *OutputPath);
+		return FString();
+	}
+
+	UE_LOG(LogLoggerLibrary, Display, TEXT("Wrote the logging trace to %s"), *OutputPath);
+	return OutputPath;
+}
+
+void FLoggerTrace::Capture(ELoggerTraceCall Call, const UObject* Caller, const FString& Template, ELoggerLevel Level)
+{
+	const uint64 Cycles = FPlatformTime::Cycles64();
+	const FString ClassPath = Caller ? Caller->GetClass()->GetPathName() : FString();
+
+	FScopeLock ScopeLock(&Lock);
+	if (!IsCapturing() || bTruncated)
+	{
+		return;
+	}
+	if (Buffer.Num() >= TraceMaxBytes)
+	{
+		bTruncated = true;
+		return;
+	}
+
+	const int32 ClassIndex = InternString(ClassPath);
+	const int32 TemplateIndex = InternString(Template);
+
+	const double DeltaMicroseconds = FPlatformTime::ToMilliseconds64(Cycles - FMath::Min(LastCycles, Cycles)) * 1000.0;
+	LastCycles = Cycles;
+
+	Buffer.Add(static_cast<uint8>((static_cast<uint8>(Call) << 3) | static_cast<uint8>(Level)));
+	WriteVarInt(Buffer, static_cast<uint32>(FMath::Min(DeltaMicroseconds, static_cast<double>(MAX_uint32))));
+	WriteVarInt(Buffer, static_cast<uint32>(ClassIndex));
+	WriteVarInt(Buffer, static_cast<uint32>(TemplateIndex));
+}
+
+bool FLoggerTrace::Load(const FString& FilePath, FLoggerTraceData& OutTrace)
+{
+	OutTrace.Strings.Reset();
+	OutTrace.Events.Reset();
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+	{
+		return false;
+	}
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	if (Bytes.Num() < 8)
+	{
+		return false;
+	}
+	FMemory::Memcpy(&Magic, Bytes.GetData(), sizeof(Magic));
+	FMemory::Memcpy(&Version, Bytes.GetData() + 4, sizeof(Version));
+	if (Magic != TraceMagic || Version != TraceVersion)
+	{
+		return false;
+	}
+
+	int32 Offset = 8;
+	while (Offset < Bytes.Num())
+	{
+		const uint8 Tag = Bytes[Offset++];
+		if (Tag == StringTag)
+		{
+			uint32 Length = 0;
+			if (!ReadVarInt(Bytes, Offset, Length) || Offset + static_cast<int64>(Length) > Bytes.Num())
+			{
+				return false;
+			}
+			const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData() + Offset), Length);
+			OutTrace.Strings.Emplace(Converted.Length(), Converted.Get());
+			Offset += Length;
+			continue;
+		}
+
+		FLoggerTraceEvent& Event = OutTrace.Events.AddDefaulted_GetRef();
+		Event.Call = static_cast<ELoggerTraceCall>(Tag >> 3);
+		Event.Level = static_cast<ELoggerLevel>(Tag & 0x7);
+
+		uint32 ClassIndex = 0;
+		uint32 TemplateIndex = 0;
+		if (!ReadVarInt(Bytes, Offset, Event.DeltaMicroseconds) || !ReadVarInt(Bytes, Offset, ClassIndex) || !ReadVarInt(Bytes, Offset, TemplateIndex))
+		{
+			return false;
+		}
+		if (Event.Call >= ELoggerTraceCall::Num || static_cast<int32>(ClassIndex) >= OutTrace.Strings.Num() || static_cast<int32>(TemplateIndex) >= OutTrace.Strings.Num())
+		{
+			return false;
+		}
+		Event.ClassIndex = static_cast<int32>(ClassIndex);
+		Event.TemplateIndex = static_cast<int32>(TemplateIndex);
+	}
+
+	return true;
+}
+
+int32 FLoggerTrace::InternString(const FString& String)
+{
+	if (const int32* Index = StringIndices.Find(String))
+	{
+		return *Index;
+	}
+
+	const int32 Index = StringIndices.Num();
+	StringIndices.Add(String, Index);
+
+	const FTCHARToUTF8 Converted(*String, String.Len());
+	Buffer.Add(StringTag);
+	WriteVarInt(Buffer, static_cast<uint32>(Converted.Length()));
+	Buffer.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	return Index;
+}
@@ -0,0 +1,268 @@
+/**
+ * @file		LoggerUtf8.cpp
+ * @brief		Converts formatted records from TCHAR to UTF‑8 for the byte oriented sinks.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerUtf8.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "LoggerLog.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#define GRONK_UTF8_SSE2 1
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON && PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS
+#include <arm_neon.h>
+#define GRONK_UTF8_NEON 1
+#endif
+
+#ifndef GRONK_UTF8_SSE2
+#define GRONK_UTF8_SSE2 0
+#endif
+#ifndef GRONK_UTF8_NEON
+#define GRONK_UTF8_NEON 0
+#endif
+
+static FAutoConsoleCommand CmdBenchUtf8(
+	TEXT("gronk.log.Bench.Utf8"),
+	TEXT("Times the logger's UTF-8 conversion against StringCast. Usage: gronk.log.Bench.Utf8 [Iterations]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FLoggerUtf8::RunBenchmark(Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000);
+	}));
+
+/**
+ * @brief Narrows the leading run of ASCII characters, sixteen at a time.
+ *
+ * @param Out	Where to write the narrowed bytes. Must have room for Len bytes.
+ * @param Chars	The characters to narrow.
+ * @param Len	The number of characters.
+ * @return The number of characters narrowed. Less than Len if a non‑ASCII block was reached.
+ */
+static FORCEINLINE int32 NarrowAsciiRun(uint8* Out, const TCHAR* Chars, int32 Len)
+{
+	int32 Index = 0;
+
+	if constexpr (sizeof(TCHAR) == 2)
+	{
+#if GRONK_UTF8_SSE2
+		const __m128i NonAsciiMask = _mm_set1_epi16(static_cast<short>(0xFF80));
+		const __m128i Zero = _mm_setzero_si128();
+		for (; Index + 16 <= Len; Index += 16)
+		{
+			const __m128i Low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Chars + Index));
+			const __m128i High = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Chars + Index + 8));
+			const __m128i NonAscii = _mm_and_si128(_mm_or_si128(Low, High), NonAsciiMask);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(NonAscii, Zero)) != 0xFFFF)
+			{
+				break;
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + Index), _mm_packus_epi16(Low, High));
+		}
+#elif GRONK_UTF8_NEON
+		for (; Index + 16 <= Len; Index += 16)
+		{
+			const uint16x8_t Low = vld1q_u16(reinterpret_cast<const uint16_t*>(Chars + Index));
+			const uint16x8_t High = vld1q_u16(reinterpret_cast<const uint16_t*>(Chars + Index + 8));
+			if (vmaxvq_u16(vorrq_u16(Low, High)) >= 0x80)
+			{
+				break;
+			}
+			vst1q_u8(Out + Index, vcombine_u8(vmovn_u16(Low), vmovn_u16(High)));
+		}
+#endif
+	}
+
+	for (; Index < Len && static_cast<uint32>(Chars[Index]) < 0x80; ++Index)
+	{
+		Out[Index] = static_cast<uint8>(Chars[Index]);
+	}
+	return Index;
+}
+
+/**
+ * @brief Encodes one character, or a surrogate pair, as UTF‑8.
+ *
+ * @param Out	Where to write the bytes. Must have room for four bytes.
+ * @param Chars	The characters to encode.
+ * @param Len	The number of characters.
+ * @param Index	The index of the character to encode, advanced past it.
+ * @return The number of bytes written.
+ */
+static FORCEINLINE int32 EncodeChar(uint8* Out, const TCHAR* Chars, int32 Len, int32& Index)
+{
+	uint32 CodePoint = static_cast<uint32>(Chars[Index++]);
+
+	if constexpr (sizeof(TCHAR) == 2)
+	{
+		CodePoint &= 0xFFFF;
+		if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && Index < Len)
+		{
+			const uint32 Low = static_cast<uint32>(Chars[Index]) & 0xFFFF;
+			if (Low >= 0xDC00 && Low <= 0xDFFF)
+			{
+				CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+				++Index;
+			}
+		}
+	}
+
+	// Unpaired surrogates and values past the last code point are not encodable.
+	if ((CodePoint >= 0xD800 && CodePoint <= 0xDFFF) || CodePoint > 0x10FFFF)
+	{
+		CodePoint = 0xFFFD;
+	}
+
+	if (CodePoint < 0x80)
+	{
+		Out[0] = static_cast<uint8>(CodePoint);
+		return 1;
+	}
+	if (CodePoint < 0x800)
+	{
+		Out[0] = static_cast<uint8>(0xC0 | (CodePoint >> 6));
+		Out[1] = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+		return 2;
+	}
+	if (CodePoint < 0x10000)
+	{
+		Out[0] = static_cast<uint8>(0xE0 | (CodePoint >> 12));
+		Out[1] = static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F));
+		Out[2] = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+		return 3;
+	}
+	Out[0] = static_cast<uint8>(0xF0 | (CodePoint >> 18));
+	Out[1] = static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F));
+	Out[2] = static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F));
+	Out[3] = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+	return 4;
+}
+
+/**
+ * @brief Counts the UTF‑8 bytes EncodeChar writes for a string.
+ *
+ * @param Chars	The characters to count.
+ * @param Len	The number of characters.
+ * @return The number of bytes.
+ */
+static int32 CountUtf8Bytes(const TCHAR* Chars, int32 Len)
+{
+	int32 NumBytes = 0;
+	for (int32 Index = 0; Index < Len; ++Index)
+	{
+		uint32 CodePoint = static_cast<uint32>(Chars[Index]);
+		if constexpr (sizeof(TCHAR) == 2)
+		{
+			CodePoint &= 0xFFFF;
+			if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && Index + 1 < Len)
+			{
+				const uint32 Low = static_cast<uint32>(Chars[Index + 1]) & 0xFFFF;
+				if (Low >= 0xDC00 && Low <= 0xDFFF)
+				{
+					NumBytes += 4;
+					++Index;
+					continue;
+				}
+			}
+		}
+
+		// Unpaired surrogates and values past the last code point become U+FFFD.
+		if ((CodePoint >= 0xD800 && CodePoint <= 0xDFFF) || CodePoint > 0x10FFFF)
+		{
+			NumBytes += 3;
+		}
+		else
+		{
+			NumBytes += CodePoint < 0x80 ? 1 : CodePoint < 0x800 ? 2 : CodePoint < 0x10000 ? 3 : 4;
+		}
+	}
+	return NumBytes;
+}
+
+void FLoggerUtf8::Append(TArray<uint8>& Bytes, const TCHAR* Chars, int32 Len, int32 ExtraBytes)
+{
+	// Size for all ASCII first, so the usual line is allocated exactly and converted in one pass.
+	const int32 Start = Bytes.Num();
+	Bytes.Reserve(Start + Len + ExtraBytes);
+	Bytes.AddUninitialized(Len);
+
+	int32 Index = NarrowAsciiRun(Bytes.GetData() + Start, Chars, Len);
+	if (Index == Len)
+	{
+		return;
+	}
+
+	// Past the first non‑ASCII character, count the exact size rather than keep worst case slack.
+	int32 Written = Index;
+	const int32 NumBytes = Written + CountUtf8Bytes(Chars + Index, Len - Index);
+	Bytes.Reserve(Start + NumBytes + ExtraBytes);
+	Bytes.SetNumUninitialized(Start + NumBytes, false);
+	uint8* Out = Bytes.GetData() + Start;
+
+	while (Index < Len)
+	{
+		// Encode the non‑ASCII characters one at a time until ASCII resumes.
+		while (Index < Len && static_cast<uint32>(Chars[Index]) >= 0x80)
+		{
+			Written += EncodeChar(Out + Written, Chars, Len, Index);
+		}
+
+		const int32 Narrowed = NarrowAsciiRun(Out + Written, Chars + Index, Len - Index);
+		Written += Narrowed;
+		Index += Narrowed;
+	}
+
+	check(Written == NumBytes);
+}
+
+TArray<uint8> FLoggerUtf8::ToLine(const FString& Text)
+{
+	TArray<uint8> Bytes;
+	Append(Bytes, *Text, Text.Len(), 1);
+	Bytes.Add('\n');
+	return Bytes;
+}
+
+void FLoggerUtf8::RunBenchmark(int32 Iterations)
+{
+	const FString Samples[] = {
+		TEXT("[ELoggerLevel::Display]\tBP_PlayerCharacter_C_0.HealthComponent: Health changed: 87.500000"),
+		TEXT("[ELoggerLevel::Warning]\tBP_Enemy_C_12: Path blocked at X=1024.000 Y=-512.000 Z=96.000"),
+		TEXT("[ELoggerLevel::Log]\tBP_Shop_C_1: Purchased Épée légendaire for 1 200 € \U0001F5E1")
+	};
+
+	for (const FString& Sample : Samples)
+	{
+		TArray<uint8> Bytes;
+		uint64 Checksum = 0;
+
+		const double FastStart = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Bytes.Reset();
+			Append(Bytes, *Sample, Sample.Len());
+			Checksum += Bytes.Num();
+		}
+		const double FastSeconds = FPlatformTime::Seconds() - FastStart;
+
+		const double EngineStart = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const auto Converted = StringCast<UTF8CHAR>(*Sample, Sample.Len());
+			Checksum += Converted.Length();
+		}
+		const double EngineSeconds = FPlatformTime::Seconds() - EngineStart;
+
+		const auto Reference = StringCast<UTF8CHAR>(*Sample, Sample.Len());
+		const bool bMatches = Bytes.Num() == Reference.Length() && FMemory::Memcmp(Bytes.GetData(), Reference.Get(), Bytes.Num()) == 0;
+
+		UE_LOG(LogLoggerLibrary, Display, TEXT("[Bench.Utf8]\tchars= %d logger= %.1f ns/line engine= %.1f ns/line speedup= %.2fx matches= %s (checksum %llu)"),
+			Sample.Len(),
+			FastSeconds * 1e9 / Iterations,
+			EngineSeconds * 1e9 / Iterations,
+			FastSeconds > 0.0 ? EngineSeconds / FastSeconds : 0.0,
+			bMatches ? TEXT("true") : TEXT("false"),
+			Checksum);
+	}
+}
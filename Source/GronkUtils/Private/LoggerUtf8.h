@@ -0,0 +1,46 @@
+/**
+ * @file		LoggerUtf8.h
+ * @brief		Converts formatted records from TCHAR to UTF‑8 for the byte oriented sinks.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @class FLoggerUtf8
+ * @brief Encodes TCHAR strings as UTF‑8 straight into a byte buffer.
+ *
+ * Log lines are nearly always ASCII, so runs of ASCII characters are narrowed sixteen at a time
+ * with SSE2 or NEON. The first non‑ASCII character drops to a scalar encoder, which handles
+ * surrogate pairs and replaces unpaired surrogates with U+FFFD.
+ */
+class FLoggerUtf8
+{
+public:
+	/**
+	 * @brief Appends a string to a buffer as UTF‑8, growing the buffer to exactly the size needed.
+	 *
+	 * @param Bytes			The buffer to append to.
+	 * @param Chars			The characters to encode.
+	 * @param Len			The number of characters.
+	 * @param ExtraBytes	The room to leave for bytes the caller appends next, such as a newline.
+	 */
+	static void Append(TArray<uint8>& Bytes, const TCHAR* Chars, int32 Len, int32 ExtraBytes = 0);
+
+	/**
+	 * @brief Encodes a string as UTF‑8 followed by a newline.
+	 *
+	 * @param Text The string to encode.
+	 * @return The UTF‑8 bytes.
+	 */
+	static TArray<uint8> ToLine(const FString& Text);
+
+	/**
+	 * @brief Times Append against the engine's StringCast and logs the results.
+	 *
+	 * @param Iterations The number of times each sample line is converted.
+	 */
+	static void RunBenchmark(int32 Iterations);
+};
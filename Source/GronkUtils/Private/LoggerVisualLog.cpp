@@ -0,0 +1,69 @@
+/**
+ * @file		LoggerVisualLog.cpp
+ * @brief		Mirrors spatial values logged by the logger library into the Visual Logger.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerVisualLog.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "LoggerBuiltinSinks.h"
+#include "LoggerLog.h"
+
+// The length of the arrows and axes drawn for rotations and transforms, in world units.
+static constexpr float ShapeLength = 100.f;
+
+// The radius of the points drawn for locations, in world units.
+static constexpr float PointRadius = 10.f;
+
+/**
+ * @brief Finds the object shapes are recorded under.
+ *
+ * @param Caller The calling object.
+ * @return The caller's owning actor, or the caller if it has none.
+ */
+static const UObject* GetShapeOwner(const UObject* Caller)
+{
+	if (const UActorComponent* Component = Cast<UActorComponent>(Caller))
+	{
+		if (const AActor* Owner = Component->GetOwner())
+		{
+			return Owner;
+		}
+	}
+	return Caller;
+}
+
+void FLoggerVisualLog::Vector(const UObject* Caller, const FString& Message, const FVector& Value, ELoggerLevel Level)
+{
+#if ENABLE_VISUAL_LOG
+	FVisualLogger::GeometryShapeLogf(GetShapeOwner(Caller), LogLoggerLibrary, ToLogVerbosity(Level), Value, PointRadius,
+		FLoggerOnScreenSink::GetColorForLevel(Level), TEXT("%s"), *Message);
+#endif
+}
+
+void FLoggerVisualLog::Rotator(const UObject* Caller, const FString& Message, const FRotator& Value, ELoggerLevel Level)
+{
+#if ENABLE_VISUAL_LOG
+	const UObject* Owner = GetShapeOwner(Caller);
+	const AActor* Actor = Cast<AActor>(Owner);
+	const FVector Start = Actor ? Actor->GetActorLocation() : FVector::ZeroVector;
+
+	FVisualLogger::ArrowLogf(Owner, LogLoggerLibrary, ToLogVerbosity(Level), Start, Start + Value.Vector() * ShapeLength,
+		FLoggerOnScreenSink::GetColorForLevel(Level), TEXT("%s"), *Message);
+#endif
+}
+
+void FLoggerVisualLog::Transform(const UObject* Caller, const FString& Message, const FTransform& Value, ELoggerLevel Level)
+{
+#if ENABLE_VISUAL_LOG
+	const UObject* Owner = GetShapeOwner(Caller);
+	const ELogVerbosity::Type Verbosity = ToLogVerbosity(Level);
+	const FVector Origin = Value.GetLocation();
+
+	FVisualLogger::GeometryShapeLogf(Owner, LogLoggerLibrary, Verbosity, Origin, PointRadius, FLoggerOnScreenSink::GetColorForLevel(Level), TEXT("%s"), *Message);
+	FVisualLogger::GeometryShapeLogf(Owner, LogLoggerLibrary, Verbosity, Origin, Origin + Value.GetUnitAxis(EAxis::X) * ShapeLength, FColor::Red, 2, TEXT(""));
+	FVisualLogger::GeometryShapeLogf(Owner, LogLoggerLibrary, Verbosity, Origin, Origin + Value.GetUnitAxis(EAxis::Y) * ShapeLength, FColor::Green, 2, TEXT(""));
+	FVisualLogger::GeometryShapeLogf(Owner, LogLoggerLibrary, Verbosity, Origin, Origin + Value.GetUnitAxis(EAxis::Z) * ShapeLength, FColor::Blue, 2, TEXT(""));
+#endif
+}
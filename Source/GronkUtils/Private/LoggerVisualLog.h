@@ -0,0 +1,73 @@
+/**
+ * @file		LoggerVisualLog.h
+ * @brief		Mirrors spatial values logged by the logger library into the Visual Logger.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoggerLibrary.h"
+#include "VisualLogger/VisualLogger.h"
+
+/**
+ * @class FLoggerVisualLog
+ * @brief Draws logged vectors, rotators and transforms as Visual Logger shapes.
+ *
+ * Shapes are recorded under the caller's owning actor. Callers check IsActive first, which is a
+ * flag test while the Visual Logger is not recording, so nothing is resolved or formatted.
+ */
+class FLoggerVisualLog
+{
+public:
+	/**
+	 * @brief Sets whether logged spatial values are mirrored into the Visual Logger.
+	 *
+	 * @param bInEnabled Whether to mirror them.
+	 */
+	static void Configure(bool bInEnabled) { bEnabled = bInEnabled; }
+
+	/** @return True if shapes should be recorded. */
+	static bool IsActive()
+	{
+#if ENABLE_VISUAL_LOG
+		return bEnabled && FVisualLogger::IsRecording();
+#else
+		return false;
+#endif
+	}
+
+	/**
+	 * @brief Records a vector as a point.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Message	The message to label the shape with.
+	 * @param Value		The vector.
+	 * @param Level		Log level of the message.
+	 */
+	static void Vector(const UObject* Caller, const FString& Message, const FVector& Value, ELoggerLevel Level);
+
+	/**
+	 * @brief Records a rotator as an arrow from the caller's owning actor.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Message	The message to label the shape with.
+	 * @param Value		The rotator.
+	 * @param Level		Log level of the message.
+	 */
+	static void Rotator(const UObject* Caller, const FString& Message, const FRotator& Value, ELoggerLevel Level);
+
+	/**
+	 * @brief Records a transform as a point and a segment along each of its axes.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Message	The message to label the shape with.
+	 * @param Value		The transform.
+	 * @param Level		Log level of the message.
+	 */
+	static void Transform(const UObject* Caller, const FString& Message, const FTransform& Value, ELoggerLevel Level);
+
+private:
+	/** Whether logged spatial values are mirrored into the Visual Logger. */
+	inline static bool bEnabled = false;
+};
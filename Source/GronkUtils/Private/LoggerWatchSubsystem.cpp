@@ -0,0 +1,268 @@
+/**
+ * @file		LoggerWatchSubsystem.cpp
+ * @brief		A world subsystem that watches objects and logs when they change.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerWatchSubsystem.h"
+
+/**
+ * @brief Logs the current value of a watched property through the matching logger function.
+ *
+ * @param Caller	The calling object.
+ * @param Label		The label to log the value with.
+ * @param Property	The property being watched.
+ * @param ValuePtr	The address of the property's value.
+ * @param Level		Log level of the message.
+ */
+static void LogPropertyValue(UObject* Caller, const FString& Label, const FProperty* Property, const void* ValuePtr, ELoggerLevel Level)
+{
+	if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		ULoggerLibrary::LogBool(Caller, Label, BoolProperty->GetPropertyValue(ValuePtr), Level);
+		return;
+	}
+
+	const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+	if (NumericProperty && !NumericProperty->IsEnum())
+	{
+		if (NumericProperty->IsFloatingPoint())
+		{
+			ULoggerLibrary::LogFloat(Caller, Label, NumericProperty->GetFloatingPointPropertyValue(ValuePtr), Level);
+			return;
+		}
+
+		const int64 Value = NumericProperty->GetSignedIntPropertyValue(ValuePtr);
+		if (Value >= MIN_int32 && Value <= MAX_int32)
+		{
+			ULoggerLibrary::LogInt(Caller, Label, static_cast<int32>(Value), Level);
+			return;
+		}
+	}
+
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		if (StructProperty->Struct == TBaseStructure<FVector>::Get())
+		{
+			ULoggerLibrary::LogVector(Caller, Label, *static_cast<const FVector*>(ValuePtr), Level);
+			return;
+		}
+		if (StructProperty->Struct == TBaseStructure<FRotator>::Get())
+		{
+			ULoggerLibrary::LogRotator(Caller, Label, *static_cast<const FRotator*>(ValuePtr), Level);
+			return;
+		}
+		if (StructProperty->Struct == TBaseStructure<FTransform>::Get())
+		{
+			ULoggerLibrary::LogTransform(Caller, Label, *static_cast<const FTransform*>(ValuePtr), Level);
+			return;
+		}
+	}
+
+	if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+	{
+		ULoggerLibrary::LogObject(Caller, Label, ObjectProperty->GetObjectPropertyValue(ValuePtr), Level);
+		return;
+	}
+
+	// Anything else is logged in its exported text form, which is only built if it will be emitted.
+	if (ULoggerLibrary::ShouldLogMessage(Caller, Level))
+	{
+		FString ValueString;
+		Property->ExportTextItem_Direct(ValueString, ValuePtr, nullptr, nullptr, PPF_None);
+		ULoggerLibrary::LogMessage(Caller, Label + TEXT(": ") + ValueString, Level);
+	}
+}
+
+void ULoggerWatchSubsystem::Deinitialize()
+{
+	for (int32 Index = PropertyWatches.Num() - 1; Index >= 0; --Index)
+	{
+		RemovePropertyWatchAt(Index);
+	}
+
+	Super::Deinitialize();
+}
+
+void ULoggerWatchSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SweepValidityWatches();
+	SweepPropertyWatches();
+}
+
+TStatId ULoggerWatchSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULoggerWatchSubsystem, STATGROUP_Tickables);
+}
+
+void ULoggerWatchSubsystem::SweepValidityWatches()
+{
+	// Walk backwards so removing a watch only moves entries that were already swept.
+	for (int32 Index = WatchedObjects.Num() - 1; Index >= 0; --Index)
+	{
+		if (WatchedObjects[Index].IsValid())
+		{
+			continue;
+		}
+
+		const FValidityWatch& Watch = Watches[Index];
+		if (UObject* Caller = Watch.Caller.Get())
+		{
+			ULoggerLibrary::LogMessage(Caller, Watch.Message, Watch.Level);
+		}
+
+		RemoveValidityWatchAt(Index);
+	}
+}
+
+void ULoggerWatchSubsystem::WatchObjectValidity(UObject* Caller, UObject* InObject, const FString& Message, ELoggerLevel Level)
+{
+	// An object that is already invalid can never make the valid to invalid transition.
+	if (!IsValid(InObject))
+	{
+		return;
+	}
+
+	const FValidityWatchKey Key(FObjectKey(Caller), FObjectKey(InObject));
+	if (const int32* ExistingIndex = WatchIndices.Find(Key))
+	{
+		FValidityWatch& Watch = Watches[*ExistingIndex];
+		Watch.Message = Message;
+		Watch.Level = Level;
+		return;
+	}
+
+	WatchIndices.Add(Key, WatchedObjects.Num());
+	WatchedObjects.Add(InObject);
+	WatchKeys.Add(Key);
+	Watches.Add({ Caller, Message, Level });
+}
+
+void ULoggerWatchSubsystem::StopWatchingObjectValidity(UObject* Caller, UObject* InObject)
+{
+	if (const int32* ExistingIndex = WatchIndices.Find(FValidityWatchKey(FObjectKey(Caller), FObjectKey(InObject))))
+	{
+		RemoveValidityWatchAt(*ExistingIndex);
+	}
+}
+
+void ULoggerWatchSubsystem::RemoveValidityWatchAt(int32 Index)
+{
+	WatchIndices.Remove(WatchKeys[Index]);
+
+	WatchedObjects.RemoveAtSwap(Index, 1, false);
+	WatchKeys.RemoveAtSwap(Index, 1, false);
+	Watches.RemoveAtSwap(Index, 1, false);
+
+	// The last watch was swapped into the freed slot, so point its key at the new index.
+	if (Index < WatchKeys.Num())
+	{
+		WatchIndices[WatchKeys[Index]] = Index;
+	}
+}
+
+bool ULoggerWatchSubsystem::WatchProperty(UObject* Caller, UObject* InObject, const FString& PropertyPath, ELoggerLevel Level)
+{
+	if (!IsValid(InObject))
+	{
+		return false;
+	}
+
+	// Resolve the path into the leaf property and its offset from the start of the object.
+	TArray<FString> Segments;
+	PropertyPath.ParseIntoArray(Segments, TEXT("."));
+
+	const UStruct* Struct = InObject->GetClass();
+	const FProperty* Property = nullptr;
+	int32 Offset = 0;
+
+	for (int32 SegmentIndex = 0; SegmentIndex < Segments.Num(); ++SegmentIndex)
+	{
+		Property = Struct ? FindFProperty<FProperty>(Struct, *Segments[SegmentIndex]) : nullptr;
+		if (!Property)
+		{
+			ULoggerLibrary::LogMessage(Caller, FString::Printf(TEXT("Cannot watch unknown property '%s' on %s"), *PropertyPath, *InObject->GetName()), ELoggerLevel::Warning);
+			return false;
+		}
+
+		Offset += Property->GetOffset_ForInternal();
+
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		Struct = StructProperty ? StructProperty->Struct : nullptr;
+	}
+
+	if (!Property)
+	{
+		return false;
+	}
+
+	StopWatchingProperty(Caller, InObject, PropertyPath);
+
+	FPropertyWatch& Watch = PropertyWatches.AddDefaulted_GetRef();
+	Watch.Object = InObject;
+	Watch.Caller = Caller;
+	Watch.Property = Property;
+	Watch.Offset = Offset;
+	Watch.PropertyPath = PropertyPath;
+	Watch.Level = Level;
+
+	// Bitfield bools share their byte with other flags, so they always go through Identical.
+	Watch.bPlainOldData = Property->HasAnyPropertyFlags(CPF_IsPlainOldData) && !Property->IsA<FBoolProperty>();
+
+	const uint8* ValuePtr = reinterpret_cast<const uint8*>(InObject) + Offset;
+	Watch.Snapshot.SetNumUninitialized(Property->GetSize());
+	Property->InitializeValue(Watch.Snapshot.GetData());
+	Property->CopyCompleteValue(Watch.Snapshot.GetData(), ValuePtr);
+
+	// Log the starting value so the first change has something to be read against.
+	LogPropertyValue(Caller, PropertyPath, Property, ValuePtr, Level);
+	return true;
+}
+
+void ULoggerWatchSubsystem::StopWatchingProperty(UObject* Caller, UObject* InObject, const FString& PropertyPath)
+{
+	for (int32 Index = PropertyWatches.Num() - 1; Index >= 0; --Index)
+	{
+		const FPropertyWatch& Watch = PropertyWatches[Index];
+		if (Watch.Object == InObject && Watch.Caller == Caller && Watch.PropertyPath == PropertyPath)
+		{
+			RemovePropertyWatchAt(Index);
+		}
+	}
+}
+
+void ULoggerWatchSubsystem::SweepPropertyWatches()
+{
+	for (int32 Index = PropertyWatches.Num() - 1; Index >= 0; --Index)
+	{
+		FPropertyWatch& Watch = PropertyWatches[Index];
+
+		UObject* Object = Watch.Object.Get();
+		if (!Object)
+		{
+			RemovePropertyWatchAt(Index);
+			continue;
+		}
+
+		const uint8* ValuePtr = reinterpret_cast<const uint8*>(Object) + Watch.Offset;
+		const bool bChanged = Watch.bPlainOldData
+			? FMemory::Memcmp(ValuePtr, Watch.Snapshot.GetData(), Watch.Snapshot.Num()) != 0
+			: !Watch.Property->Identical(ValuePtr, Watch.Snapshot.GetData(), PPF_None);
+
+		if (bChanged)
+		{
+			Watch.Property->CopyCompleteValue(Watch.Snapshot.GetData(), ValuePtr);
+			LogPropertyValue(Watch.Caller.Get(), Watch.PropertyPath, Watch.Property, ValuePtr, Watch.Level);
+		}
+	}
+}
+
+void ULoggerWatchSubsystem::RemovePropertyWatchAt(int32 Index)
+{
+	FPropertyWatch& Watch = PropertyWatches[Index];
+	Watch.Property->DestroyValue(Watch.Snapshot.GetData());
+
+	PropertyWatches.RemoveAtSwap(Index, 1, false);
+}
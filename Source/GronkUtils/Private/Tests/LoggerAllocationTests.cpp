@@ -0,0 +1,100 @@
+/**
+ * @file		LoggerAllocationTests.cpp
+ * @brief		Automation tests for the allocation scope and the allocation free logging paths.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerAllocationScope.h"
+#include "LoggerLibrary.h"
+#include "LoggerLog.h"
+#include "LoggerOnceLatch.h"
+#include "LoggerSessionStats.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && GRONK_WITH_ALLOCATION_TRACKING
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoggerAllocationScopeCountsTest, "GronkUtils.Logger.Allocations.ScopeCounts",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter);
+
+bool FLoggerAllocationScopeCountsTest::RunTest(const FString& Parameters)
+{
+	// The proxy must see a deliberate allocation, or every no allocation check below passes vacuously.
+	FLoggerAllocationScope Scope;
+	{
+		TArray<int32> Allocated;
+		Allocated.Reserve(64);
+	}
+	TestTrue(TEXT("The allocation is counted"), Scope.GetNumAllocations() >= 1);
+	TestTrue(TEXT("Its bytes are counted"), Scope.GetNumBytes() >= 64 * sizeof(int32));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoggerSuppressedLevelNoAllocTest, "GronkUtils.Logger.Allocations.SuppressedLevel",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter);
+
+bool FLoggerSuppressedLevelNoAllocTest::RunTest(const FString& Parameters)
+{
+	// Make sure VeryVerbose is below both the output log and the on screen thresholds.
+	const ELogVerbosity::Type SavedVerbosity = LogLoggerLibrary.GetVerbosity();
+	const ELoggerLevel SavedDisplayLevel = ULoggerLibrary::GetDisplayLogLevel();
+	LogLoggerLibrary.SetVerbosity(ELogVerbosity::Log);
+	ULoggerLibrary::SetDisplayLogLevel(ELoggerLevel::Display);
+
+	const FString Message(TEXT("Suppressed message"));
+
+	// First calls may allocate, e.g. to register this thread's counters.
+	ULoggerLibrary::LogMessage(nullptr, Message, ELoggerLevel::VeryVerbose);
+
+	GRONK_EXPECT_NO_ALLOC
+	{
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			ULoggerLibrary::LogMessage(nullptr, Message, ELoggerLevel::VeryVerbose);
+		}
+	}
+
+	LogLoggerLibrary.SetVerbosity(SavedVerbosity);
+	ULoggerLibrary::SetDisplayLogLevel(SavedDisplayLevel);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoggerLatchedOnceNoAllocTest, "GronkUtils.Logger.Allocations.LatchedOnce",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter);
+
+bool FLoggerLatchedOnceNoAllocTest::RunTest(const FString& Parameters)
+{
+	// Stand-ins for the bytecode addresses of two Log Once nodes.
+	static const uint8 CallSite = 0;
+	static const uint8 PerObjectCallSite = 0;
+	const UObject* Object = GetTransientPackage();
+
+	FLoggerOnceLatch::Latch(&CallSite);
+	FLoggerOnceLatch::LatchForObject(&PerObjectCallSite, Object);
+
+	// The first per object check fills this thread's cache, and the first suppression registers its counters.
+	TestTrue(TEXT("The call site is latched"), FLoggerOnceLatch::IsLatched(&CallSite));
+	TestTrue(TEXT("The call site is latched for the object"), FLoggerOnceLatch::IsLatchedForObject(&PerObjectCallSite, Object));
+	FLoggerSessionStats::RecordSuppressed(ELoggerGate::Once);
+
+	// The same work a latched "Log Once" node does before returning.
+	GRONK_EXPECT_NO_ALLOC
+	{
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			if (FLoggerOnceLatch::IsLatched(&CallSite))
+			{
+				FLoggerSessionStats::RecordSuppressed(ELoggerGate::Once);
+			}
+			if (FLoggerOnceLatch::IsLatchedForObject(&PerObjectCallSite, Object))
+			{
+				FLoggerSessionStats::RecordSuppressed(ELoggerGate::Once);
+			}
+		}
+	}
+
+	// The stand-in call sites stay latched rather than resetting the latches of real nodes.
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && GRONK_WITH_ALLOCATION_TRACKING
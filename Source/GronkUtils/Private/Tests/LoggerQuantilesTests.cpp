@@ -0,0 +1,61 @@
+/**
+ * @file		LoggerQuantilesTests.cpp
+ * @brief		Automation tests for the logger's quantile sketches.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerQuantiles.h"
+#include "Misc/AutomationTest.h"
+#include <limits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoggerQuantilesNonFiniteTest, "GronkUtils.Logger.Quantiles.NonFinite",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter);
+
+bool FLoggerQuantilesNonFiniteTest::RunTest(const FString& Parameters)
+{
+	const double Infinity = std::numeric_limits<double>::infinity();
+	const double NaN = std::numeric_limits<double>::quiet_NaN();
+
+	// Non‑finite values first, so they would open the stores if they were binned.
+	FLoggerQuantileSketch Sketch;
+	Sketch.Add(Infinity);
+	Sketch.Add(NaN);
+	Sketch.Add(-Infinity);
+	for (int32 Value = 1; Value <= 1000; ++Value)
+	{
+		Sketch.Add(static_cast<double>(Value));
+	}
+
+	TestEqual(TEXT("Infinities are counted"), Sketch.GetCount(), static_cast<uint64>(1002));
+	TestEqual(TEXT("NaNs are counted apart"), Sketch.GetNaNCount(), static_cast<uint64>(1));
+	TestEqual(TEXT("Min is negative infinity"), Sketch.GetMin(), -Infinity);
+	TestEqual(TEXT("Max is positive infinity"), Sketch.GetMax(), Infinity);
+	TestEqual(TEXT("p0 is negative infinity"), Sketch.GetQuantile(0.0), -Infinity);
+	TestEqual(TEXT("p100 is positive infinity"), Sketch.GetQuantile(1.0), Infinity);
+
+	const double P50 = Sketch.GetQuantile(0.5);
+	const double P90 = Sketch.GetQuantile(0.9);
+	TestTrue(FString::Printf(TEXT("p50 (%f) is within 1%% of 500"), P50), FMath::Abs(P50 - 500.0) <= 500.0 * FLoggerQuantileSketch::RelativeAccuracy + 1.0);
+	TestTrue(FString::Printf(TEXT("p90 (%f) is within 1%% of 900"), P90), FMath::Abs(P90 - 900.0) <= 900.0 * FLoggerQuantileSketch::RelativeAccuracy + 1.0);
+
+	// Merging carries the non‑finite counts across.
+	FLoggerQuantileSketch Merged;
+	Merged.Merge(Sketch);
+	TestEqual(TEXT("Merged count"), Merged.GetCount(), Sketch.GetCount());
+	TestEqual(TEXT("Merged NaN count"), Merged.GetNaNCount(), Sketch.GetNaNCount());
+	TestEqual(TEXT("Merged p50"), Merged.GetQuantile(0.5), P50);
+
+	// The extremes of the finite range still land in a bin.
+	FLoggerQuantileSketch Extremes;
+	Extremes.Add(TNumericLimits<double>::Max());
+	Extremes.Add(TNumericLimits<double>::Lowest());
+	Extremes.Add(1.0);
+	TestEqual(TEXT("Extremes count"), Extremes.GetCount(), static_cast<uint64>(3));
+	TestTrue(TEXT("Extremes p50 is near 1"), FMath::IsNearlyEqual(Extremes.GetQuantile(0.5), 1.0, 0.02));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,87 @@
+/**
+ * @file		LoggerUtf8Tests.cpp
+ * @brief		Automation tests for the logger's UTF‑8 encoder.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerUtf8.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * @brief Checks that the logger encodes a string the same as FTCHARToUTF8.
+ *
+ * @param Test		The running test.
+ * @param Label		What the string covers, for the error.
+ * @param Text		The string to encode.
+ */
+static void TestMatchesEngine(FAutomationTestBase& Test, const FString& Label, const FString& Text)
+{
+	TArray<uint8> Bytes;
+	FLoggerUtf8::Append(Bytes, *Text, Text.Len());
+
+	const FTCHARToUTF8 Reference(*Text, Text.Len());
+	const bool bMatches = Bytes.Num() == Reference.Length() && FMemory::Memcmp(Bytes.GetData(), Reference.Get(), Bytes.Num()) == 0;
+	Test.TestTrue(FString::Printf(TEXT("%s (%d chars) matches FTCHARToUTF8"), *Label, Text.Len()), bMatches);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoggerUtf8MatchesEngineTest, "GronkUtils.Logger.Utf8.MatchesEngine",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter);
+
+bool FLoggerUtf8MatchesEngineTest::RunTest(const FString& Parameters)
+{
+	// Every length around the sixteen character blocks, so each tail length of the SIMD loop runs.
+	const TCHAR* NonAscii[] = { TEXT("é"), TEXT("€"), TEXT("\U0001F5E1") };
+	for (int32 Len = 0; Len <= 48; ++Len)
+	{
+		FString Ascii;
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			Ascii.AppendChar(static_cast<TCHAR>(TEXT(' ') + (Index * 7) % 95));
+		}
+		TestMatchesEngine(*this, TEXT("ASCII"), Ascii);
+
+		// A non‑ASCII character at every position, including inside and right after a block.
+		for (int32 Position = 0; Position <= Len; ++Position)
+		{
+			for (const TCHAR* Char : NonAscii)
+			{
+				TestMatchesEngine(*this, FString::Printf(TEXT("Non-ASCII at %d"), Position), Ascii.Left(Position) + Char + Ascii.Mid(Position));
+			}
+		}
+	}
+
+	TestMatchesEngine(*this, TEXT("Mixed"), TEXT("[Log]\tBP_Shop_C_1: Purchased Épée légendaire for 1 200 € \U0001F5E1\U0001F600 and more ASCII after it"));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoggerUtf8SizingTest, "GronkUtils.Logger.Utf8.Sizing",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter);
+
+bool FLoggerUtf8SizingTest::RunTest(const FString& Parameters)
+{
+	// Lines queued in file sinks keep their buffers, so they must not hold worst case slack.
+	const FString Ascii = FString::ChrN(200, TEXT('a'));
+	const TArray<uint8> AsciiLine = FLoggerUtf8::ToLine(Ascii);
+	TestEqual(TEXT("ASCII line length"), AsciiLine.Num(), 201);
+	TestTrue(TEXT("ASCII line is not over allocated"), AsciiLine.Max() < AsciiLine.Num() * 5 / 4);
+
+	const FString Mixed = FString::ChrN(100, TEXT('a')) + FString::ChrN(100, TEXT('é'));
+	const TArray<uint8> MixedLine = FLoggerUtf8::ToLine(Mixed);
+	TestEqual(TEXT("Mixed line length"), MixedLine.Num(), 301);
+	TestTrue(TEXT("Mixed line is not over allocated"), MixedLine.Max() < MixedLine.Num() * 5 / 4);
+
+	if constexpr (sizeof(TCHAR) == 2)
+	{
+		// Unpaired surrogates are replaced with U+FFFD.
+		const TCHAR Unpaired[] = { TEXT('a'), static_cast<TCHAR>(0xD800), TEXT('b'), static_cast<TCHAR>(0xDC00) };
+		TArray<uint8> Bytes;
+		FLoggerUtf8::Append(Bytes, Unpaired, UE_ARRAY_COUNT(Unpaired));
+		const uint8 Expected[] = { 'a', 0xEF, 0xBF, 0xBD, 'b', 0xEF, 0xBF, 0xBD };
+		TestTrue(TEXT("Unpaired surrogates become U+FFFD"), Bytes.Num() == UE_ARRAY_COUNT(Expected) && FMemory::Memcmp(Bytes.GetData(), Expected, Bytes.Num()) == 0);
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
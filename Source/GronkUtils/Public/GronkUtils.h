@@ -7,6 +7,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "Modules/ModuleManager.h"
 
 class FGronkUtilsModule : public IModuleInterface
@@ -14,4 +15,16 @@ class FGronkUtilsModule : public IModuleInterface
 public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
-};
\ No newline at end of file
+
+private:
+	/**
+	 * @brief Ticks the periodic work of the logging utilities.
+	 *
+	 * @param DeltaTime The number of seconds since the last tick.
+	 * @return True to keep ticking.
+	 */
+	bool Tick(float DeltaTime);
+
+	/** The handle of the core ticker delegate. */
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,92 @@
+/**
+ * @file		LoggerAllocationScope.h
+ * @brief		Counts the allocations a thread makes within a scope, for logger performance tests.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Whether allocations can be counted. Counting adds a proxy in front of GMalloc, so shipping builds never do. */
+#define GRONK_WITH_ALLOCATION_TRACKING !UE_BUILD_SHIPPING
+
+/**
+ * @class FLoggerAllocationScope
+ * @brief Counts the allocations the calling thread makes while the scope is alive.
+ *
+ * The first scope installs a counting proxy in front of GMalloc that stays installed for the rest
+ * of the process. The proxy only counts on threads that have a scope open, so other threads do
+ * not pollute the counts and cost one thread local read per allocation. Scopes nest, and an outer
+ * scope includes the allocations of its inner scopes. Reallocations count as allocations.
+ */
+class GRONKUTILS_API FLoggerAllocationScope
+{
+public:
+	FLoggerAllocationScope();
+	~FLoggerAllocationScope();
+
+	FLoggerAllocationScope(const FLoggerAllocationScope&) = delete;
+	FLoggerAllocationScope& operator=(const FLoggerAllocationScope&) = delete;
+
+	/** @return The number of allocations the thread made so far in the scope. */
+	uint64 GetNumAllocations() const;
+
+	/** @return The number of bytes the thread requested so far in the scope. */
+	uint64 GetNumBytes() const;
+
+private:
+	uint64 StartAllocations = 0;
+	uint64 StartBytes = 0;
+};
+
+/**
+ * @class FLoggerExpectNoAllocScope
+ * @brief Reports an error if the thread allocates while the scope is alive. Used by GRONK_EXPECT_NO_ALLOC.
+ *
+ * The error goes to the running automation test if there is one, and to an ensure otherwise.
+ */
+class GRONKUTILS_API FLoggerExpectNoAllocScope
+{
+public:
+	/**
+	 * @param InFile The file of the checked block.
+	 * @param InLine The line of the checked block.
+	 */
+	FLoggerExpectNoAllocScope(const TCHAR* InFile, int32 InLine)
+		: File(InFile)
+		, Line(InLine)
+	{
+	}
+
+	/**
+	 * @brief Drives the loop of GRONK_EXPECT_NO_ALLOC. Runs the block once, then checks it.
+	 *
+	 * @return True while the block should run.
+	 */
+	bool Step();
+
+private:
+	const TCHAR* File;
+	int32 Line;
+	bool bRan = false;
+	FLoggerAllocationScope Scope;
+};
+
+/**
+ * Fails the running automation test if the following block allocates on the calling thread, e.g.
+ *
+ *	GRONK_EXPECT_NO_ALLOC
+ *	{
+ *		ULoggerLibrary::LogMessage(Caller, TEXT("Suppressed"), ELoggerLevel::VeryVerbose);
+ *	}
+ *
+ * Warm up caches before the block, since first calls are allowed to allocate. The block must not
+ * break or continue out of the macro. In shipping builds the block runs unchecked.
+ */
+#if GRONK_WITH_ALLOCATION_TRACKING
+#define GRONK_EXPECT_NO_ALLOC \
+	for (FLoggerExpectNoAllocScope GronkExpectNoAllocScope(TEXT(__FILE__), __LINE__); GronkExpectNoAllocScope.Step(); )
+#else
+#define GRONK_EXPECT_NO_ALLOC
+#endif
@@ -70,6 +70,64 @@ enum class EConditionOutcome : uint8
 	IsFalse UMETA(DisplayName = "False")
 };
 
+/**
+ * @enum ELoggerHeatmapFormat
+ * @brief The file format of vector heatmap dumps.
+ */
+UENUM(BlueprintType)
+enum class ELoggerHeatmapFormat : uint8
+{
+	Csv	   UMETA(DisplayName = "CSV"),
+	Binary UMETA(DisplayName = "Binary")
+};
+
+/**
+ * @enum ELoggerOutput
+ * @brief The built‑in outputs messages can be written to.
+ */
+UENUM(BlueprintType)
+enum class ELoggerOutput : uint8
+{
+	OutputLog UMETA(DisplayName = "Output Log"),
+	OnScreen  UMETA(DisplayName = "On Screen"),
+	File	  UMETA(DisplayName = "Text File"),
+	Json	  UMETA(DisplayName = "JSON Lines File"),
+	/** Only available where the engine ships the SQLiteCore plugin. */
+	Sqlite	  UMETA(DisplayName = "SQLite Database")
+};
+
+/**
+ * @enum ELoggerNetMode
+ * @brief The net modes a caller can run in, as flags for net filters.
+ */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class ELoggerNetMode : uint8
+{
+	None			= 0		 UMETA(Hidden),
+	Standalone		= 1 << 0 UMETA(DisplayName = "Standalone"),
+	DedicatedServer = 1 << 1 UMETA(DisplayName = "Dedicated Server"),
+	ListenServer	= 1 << 2 UMETA(DisplayName = "Listen Server"),
+	Client			= 1 << 3 UMETA(DisplayName = "Client")
+};
+ENUM_CLASS_FLAGS(ELoggerNetMode);
+
+/**
+ * @enum ELoggerNetRole
+ * @brief The local roles a caller can have, as flags for net filters.
+ */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class ELoggerNetRole : uint8
+{
+	None			= 0		 UMETA(Hidden),
+	SimulatedProxy	= 1 << 0 UMETA(DisplayName = "Simulated Proxy"),
+	AutonomousProxy = 1 << 1 UMETA(DisplayName = "Autonomous Proxy"),
+	Authority		= 1 << 2 UMETA(DisplayName = "Authority"),
+
+	/** The caller is not an actor and does not belong to one. */
+	NoActor			= 1 << 3 UMETA(DisplayName = "No Actor")
+};
+ENUM_CLASS_FLAGS(ELoggerNetRole);
+
 /**
  * @class ULoggerLibrary
  * @brief A blueprint‑accessible function library for logging.
@@ -88,6 +146,143 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
 	static void SetDisplayLogLevel(ELoggerLevel NewDisplayLevel);
 
+	/**
+	 * @brief Gets the global log level threshold for on‑screen display.
+	 *
+	 * @return The minimum log level required for on‑screen display.
+	 */
+	UFUNCTION(BlueprintPure, Category = "GronkUtils|Logging")
+	static ELoggerLevel GetDisplayLogLevel();
+
+	/**
+	 * @brief Enables or disables one of the outputs messages are written to.
+	 *
+	 * The output log and the screen are enabled by default. The file and database outputs write to
+	 * Saved/Logs/GronkUtils. Each message is formatted once no matter how many outputs receive it.
+	 *
+	 * @param Output	The output.
+	 * @param bEnabled	Whether the output receives messages.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static void SetOutputEnabled(ELoggerOutput Output, bool bEnabled);
+
+	/**
+	 * @brief Sets whether "Log Message with Vector" aggregates vectors into heatmaps instead of logging them.
+	 *
+	 * Vectors that pass the level and net filters are binned into a sparse grid per message, and the
+	 * grids are periodically written to Saved/Logs/GronkHeatmaps as one file per message and flush.
+	 *
+	 * @param bEnabled		Whether to aggregate logged vectors.
+	 * @param CellSize		The edge length of a grid cell, in world units.
+	 * @param FlushInterval	The number of seconds between dumps. Zero only dumps on demand.
+	 * @param Format		The file format of the dumps.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static void SetVectorHeatmapMode(bool bEnabled, float CellSize = 100.f, float FlushInterval = 10.f, ELoggerHeatmapFormat Format = ELoggerHeatmapFormat::Csv);
+
+	/**
+	 * @brief Writes all vector heatmaps collected so far to disk.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static void FlushVectorHeatmaps();
+
+	/**
+	 * @brief Sets whether "Log Message with Float" feeds values into quantile sketches instead of logging them.
+	 *
+	 * Each message gets its own sketch of constant size. Every interval the sketches of all threads
+	 * are merged and p50, p90, p99 and max are logged once per message. Values that would not
+	 * have been logged are not added.
+	 *
+	 * @param bEnabled		Whether to feed logged floats into sketches.
+	 * @param FlushInterval	The number of seconds between reports. Zero only reports on demand.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static void SetFloatQuantileMode(bool bEnabled, float FlushInterval = 10.f);
+
+	/**
+	 * @brief Logs the percentiles of all float values collected so far and starts a new interval.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static void FlushFloatQuantiles();
+
+	/**
+	 * @brief Sets whether "Log Message with Int" and "with Float" downsample each series instead of logging every value.
+	 *
+	 * A series is the values logged from one call site by one caller. Each window of values is
+	 * reduced with Largest‑Triangle‑Three‑Buckets to the points that keep its visual shape, which
+	 * are then logged with the time they were originally logged at.
+	 *
+	 * @param bEnabled			Whether to downsample logged ints and floats.
+	 * @param WindowSize		The number of values in a window.
+	 * @param PointsPerWindow	The number of values logged per window.
+	 * @param FlushInterval		The age in seconds at which a partial window is logged. Zero waits for full windows.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static void SetSeriesDownsampleMode(bool bEnabled, int32 WindowSize = 256, int32 PointsPerWindow = 32, float FlushInterval = 5.f);
+
+	/**
+	 * @brief Reduces and logs every partial window of the downsampled series.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static void FlushDownsampledSeries();
+
+	/**
+	 * @brief Sets whether vectors, rotators and transforms are also drawn in the Visual Logger.
+	 *
+	 * Shapes are recorded under the caller's owning actor, and only while the Visual Logger is
+	 * recording. Otherwise the logging functions pay nothing more than a flag test.
+	 *
+	 * @param bEnabled Whether to draw logged spatial values.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static void SetVisualLoggerMode(bool bEnabled);
+
+	/**
+	 * @brief Sets whether logging an error temporarily lets more detail through for the same context.
+	 *
+	 * After an error, every level down to the escalated level is logged for the caller (or its owning
+	 * actor) until no error has been logged by it for the given duration.
+	 *
+	 * @param bEnabled			Whether errors escalate their context.
+	 * @param EscalatedLevel	The lowest level logged while escalated.
+	 * @param Duration			The number of seconds an escalation lasts after the last error.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static void SetErrorEscalation(bool bEnabled, ELoggerLevel EscalatedLevel = ELoggerLevel::VeryVerbose, float Duration = 5.f);
+
+	/**
+	 * @brief Only lets messages through from callers running in the given net modes and roles.
+	 *
+	 * A filter applies to callers of the given class, or to components of actors of that class.
+	 * When several filters apply, the one for the most derived class wins. The net mode and role
+	 * of a caller are resolved once, and filtered messages are dropped before any string work.
+	 *
+	 * @param CallerClass	The class the filter applies to, or none for every caller.
+	 * @param NetModes		The net modes to log in.
+	 * @param Roles			The local roles to log with.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static void SetNetFilter(TSubclassOf<UObject> CallerClass,
+		UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/GronkUtils.ELoggerNetMode")) int32 NetModes,
+		UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/GronkUtils.ELoggerNetRole")) int32 Roles);
+
+	/**
+	 * @brief Sets the number of records each actor can log per second at each level.
+	 *
+	 * Components count against their owning actor. Records over the quota are dropped before any
+	 * string work, and a summary line per actor reports how many were dropped each second.
+	 *
+	 * @param RecordsPerSecond The number of records per actor, second and level. Zero removes the quota.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static void SetActorLogQuota(int32 RecordsPerSecond = 0);
+
+	/**
+	 * @brief Removes every filter added with "Set Net Filter".
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static void ClearNetFilters();
+
 	/**
 	 * @brief Logs a message to the output log.
 	 *
@@ -123,6 +318,8 @@ public:
 	/**
 	 * @brief Logs a message with a float value appended to it.
 	 *
+	 * In quantile mode the value is added to the message's sketch instead of being logged.
+	 *
 	 * @param Caller	The calling object.
 	 * @param Message	The message to log.
 	 * @param Value		The float value to append.
@@ -134,6 +331,9 @@ public:
 	/**
 	 * @brief Logs a message with a vector value appended to it.
 	 *
+	 * In heatmap mode the vector is aggregated under the message instead of being logged. In
+	 * Visual Logger mode it is also drawn as a point.
+	 *
 	 * @param Caller	The calling object.
 	 * @param Message	The message to log.
 	 * @param Value		The vector value to append.
@@ -145,6 +345,8 @@ public:
 	/**
 	 * @brief Logs a message with a rotator value appended to it.
 	 *
+	 * In Visual Logger mode the rotator is also drawn as an arrow from the caller's owning actor.
+	 *
 	 * @param Caller	The calling object.
 	 * @param Message	The message to log.
 	 * @param Value		The rotator value to append.
@@ -153,6 +355,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging", meta = (DisplayName = "Log Message with Rotator", DefaultToSelf = "Caller"))
 	static void LogRotator(UObject* Caller, const FString& Message, const FRotator& Value, ELoggerLevel Level = ELoggerLevel::Display);
 
+	/**
+	 * @brief Logs a message with a transform value appended to it.
+	 *
+	 * In Visual Logger mode the transform is also drawn as a point and its axes.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Message	The message to log.
+	 * @param Value		The transform value to append.
+	 * @param Level		Log level of the message.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging", meta = (DisplayName = "Log Message with Transform", DefaultToSelf = "Caller"))
+	static void LogTransform(UObject* Caller, const FString& Message, const FTransform& Value, ELoggerLevel Level = ELoggerLevel::Display);
+
 	/**
 	 * @brief Logs a message with an object value appended to it.
 	 *
@@ -190,7 +405,176 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging", meta = (DisplayName = "Log On Condition", ExpandEnumAsExecs = "OutExecs", DefaultToSelf = "Caller"))
 	static void LogOnCondition(UObject* Caller, bool Condition, EConditionOutcome& OutExecs, ELogBooleanCondition LogCondition, const FString& Message, ELoggerLevel Level = ELoggerLevel::Display);
 
+	/**
+	 * @brief Watches an object and logs a message once when it becomes invalid.
+	 *
+	 * Unlike polling "Log On Validity" every tick, all watches are checked natively once per frame.
+	 *
+	 * @param Caller	The calling object. Must belong to a world.
+	 * @param InObject	The object to watch.
+	 * @param Message	The message to log when the object becomes invalid.
+	 * @param Level		Log level of the message.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging", meta = (DisplayName = "Watch Object Validity", DefaultToSelf = "Caller"))
+	static void WatchObjectValidity(UObject* Caller, UObject* InObject, const FString& Message, ELoggerLevel Level = ELoggerLevel::Display);
+
+	/**
+	 * @brief Stops watching an object previously passed to "Watch Object Validity".
+	 *
+	 * @param Caller	The calling object.
+	 * @param InObject	The object to stop watching.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging", meta = (DisplayName = "Stop Watching Object Validity", DefaultToSelf = "Caller"))
+	static void StopWatchingObjectValidity(UObject* Caller, UObject* InObject);
+
+	/**
+	 * @brief Watches a property and logs its value whenever it changes.
+	 *
+	 * All watched properties are compared natively once per frame, so nothing runs in Blueprint.
+	 *
+	 * @param Caller		The calling object. Must belong to a world.
+	 * @param InObject		The object that owns the property.
+	 * @param PropertyPath	The dot separated path of the property, e.g. "Stats.Health".
+	 * @param Level			Log level of the messages.
+	 * @return True if the path resolved to a property.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging", meta = (DisplayName = "Watch Property", DefaultToSelf = "Caller"))
+	static bool WatchProperty(UObject* Caller, UObject* InObject, const FString& PropertyPath, ELoggerLevel Level = ELoggerLevel::Display);
+
+	/**
+	 * @brief Stops watching a property previously passed to "Watch Property".
+	 *
+	 * @param Caller		The calling object.
+	 * @param InObject		The object that owns the property.
+	 * @param PropertyPath	The dot separated path of the property.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging", meta = (DisplayName = "Stop Watching Property", DefaultToSelf = "Caller"))
+	static void StopWatchingProperty(UObject* Caller, UObject* InObject, const FString& PropertyPath);
+
+	/**
+	 * @brief Writes a JSON summary of the session's logging so far.
+	 *
+	 * The summary covers records per level, records suppressed at each gate, bytes formatted, time
+	 * spent logging, the top call sites and callers, on‑screen messages and drops. It is also written
+	 * automatically at shutdown.
+	 *
+	 * @param FilePath	The file to write, or empty for Saved/Logs/GronkUtils/Session-<timestamp>.json.
+	 * @return The path of the written file, or empty if it could not be written.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static FString WriteLogSessionSummary(const FString& FilePath = TEXT(""));
+
+	/**
+	 * @brief Checks whether a message logged by the caller at the given level would be emitted anywhere.
+	 *
+	 * Used by the lazy logging nodes to keep the message‑building graph behind a native check.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Level		Log level of the message.
+	 * @return True if the message would reach the output log or the screen.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging", meta = (BlueprintInternalUseOnly = "true", DefaultToSelf = "Caller"))
+	static bool ShouldLogMessage(UObject* Caller, ELoggerLevel Level = ELoggerLevel::Display);
+
+	/**
+	 * @brief Checks whether a "Log On Validity" call would emit its message.
+	 *
+	 * @param Caller		The calling object.
+	 * @param InObject		The object to validate.
+	 * @param LogCondition	Determines whether to log when the object is valid or invalid.
+	 * @param Level			The log level to use when logging.
+	 * @param bOutIsValid	Whether the object is valid.
+	 * @return True if the validity condition is met and the message would be emitted.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging", meta = (BlueprintInternalUseOnly = "true", DefaultToSelf = "Caller"))
+	static bool ShouldLogOnValidity(UObject* Caller, UObject* InObject, ELogValidityCondition LogCondition, ELoggerLevel Level, bool& bOutIsValid);
+
+	/**
+	 * @brief Checks whether a "Log On Condition" call would emit its message.
+	 *
+	 * @param Caller		The calling object.
+	 * @param Condition		The condition to check.
+	 * @param LogCondition	Determines whether to log when the condition is true or false.
+	 * @param Level			The log level to use when logging.
+	 * @param bOutCondition	The value of the condition, so it is only evaluated once.
+	 * @return True if the log condition is met and the message would be emitted.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging", meta = (BlueprintInternalUseOnly = "true", DefaultToSelf = "Caller"))
+	static bool ShouldLogOnCondition(UObject* Caller, bool Condition, ELogBooleanCondition LogCondition, ELoggerLevel Level, bool& bOutCondition);
+
+	/**
+	 * @brief Checks whether the calling "Log Once" node has not logged yet and would emit its message.
+	 *
+	 * The latch is keyed by the call site, which is read from the calling script frame.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Level		Log level of the message.
+	 * @return True the first time the call site would emit its message.
+	 */
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "GronkUtils|Logging", meta = (BlueprintInternalUseOnly = "true", DefaultToSelf = "Caller"))
+	static bool ShouldLogOnce(UObject* Caller, ELoggerLevel Level);
+
+	/**
+	 * @brief Checks whether the calling "Log Once Per Object" node has not logged about an object yet.
+	 *
+	 * @param Caller	The calling object.
+	 * @param InObject	The object the message is about.
+	 * @param Level		Log level of the message.
+	 * @return True the first time the call site would emit its message for the object.
+	 */
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "GronkUtils|Logging", meta = (BlueprintInternalUseOnly = "true", DefaultToSelf = "Caller"))
+	static bool ShouldLogOncePerObject(UObject* Caller, UObject* InObject, ELoggerLevel Level);
+
+	/**
+	 * @brief Releases the latches of every "Log Once" node, so each of them logs once more.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GronkUtils|Logging")
+	static void ResetLogOnceLatches();
+
+	DECLARE_FUNCTION(execShouldLogOnce)
+	{
+		// Native functions run in their caller's frame, so the bytecode address is unique to the call site.
+		const void* CallSite = Stack.Code;
+
+		P_GET_OBJECT(UObject, Caller);
+		P_GET_ENUM(ELoggerLevel, Level);
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+		*static_cast<bool*>(RESULT_PARAM) = ShouldLogOnceAtCallSite(CallSite, Caller, nullptr, Level, false);
+		P_NATIVE_END;
+	}
+
+	DECLARE_FUNCTION(execShouldLogOncePerObject)
+	{
+		const void* CallSite = Stack.Code;
+
+		P_GET_OBJECT(UObject, Caller);
+		P_GET_OBJECT(UObject, InObject);
+		P_GET_ENUM(ELoggerLevel, Level);
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+		*static_cast<bool*>(RESULT_PARAM) = ShouldLogOnceAtCallSite(CallSite, Caller, InObject, Level, true);
+		P_NATIVE_END;
+	}
+
 private:
+	friend class FLoggerDownsample;
+	friend class FLoggerQuantiles;
+
+	/**
+	 * @brief Checks and sets the latch of a "Log Once" call site.
+	 *
+	 * @param CallSite		The address identifying the call site.
+	 * @param Caller		The calling object.
+	 * @param InObject		The object the message is about, for the per object latch.
+	 * @param Level			Log level of the message.
+	 * @param bPerObject	Whether the latch is per object.
+	 * @return True if the message should be emitted.
+	 */
+	static bool ShouldLogOnceAtCallSite(const void* CallSite, UObject* Caller, UObject* InObject, ELoggerLevel Level, bool bPerObject);
+
 	/**
 	 * @brief The global minimum log level required for on‑screen display.
 	 *
@@ -199,10 +583,34 @@ private:
 	inline static ELoggerLevel DisplayLogLevel = ELoggerLevel::Display;
 
 	/**
-	 * @brief Gets an on‑screen text color for the given log level.
+	 * @brief Emits a message that has already passed the gate.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Message	The message to log.
+	 * @param Level		Log level of the message.
+	 * @param Time		The time the record carries.
+	 */
+	static void EmitMessage(UObject* Caller, const FString& Message, ELoggerLevel Level, const FDateTime& Time = FDateTime::UtcNow());
+
+	/**
+	 * @brief Emits a message on behalf of a caller that has since been destroyed.
 	 *
-	 * @param Level The logging level.
-	 * @return The FColor to use for on‑screen text.
+	 * @param ContextName	The context name the caller had.
+	 * @param NetLabel		The net mode label the caller had.
+	 * @param Message		The message to log.
+	 * @param Level			Log level of the message.
+	 * @param Time			The time the record carries.
+	 */
+	static void EmitMessageAs(const FString& ContextName, const FString& NetLabel, const FString& Message, ELoggerLevel Level, const FDateTime& Time);
+
+	/**
+	 * @brief Checks whether a message at the given level would be emitted anywhere.
+	 *
+	 * This is the gate every logging function passes through before doing any string work.
+	 *
+	 * @param Caller	The calling object.
+	 * @param Level		The logging level.
+	 * @return True if the message would reach the output log or the screen.
 	 */
-	static FColor GetColorForLevel(ELoggerLevel Level);
+	static bool ShouldLog(const UObject* Caller, ELoggerLevel Level);
 };
@@ -0,0 +1,184 @@
+/**
+ * @file		LoggerSink.h
+ * @brief		The outputs of the logger library and the records they receive.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoggerLibrary.h"
+
+/**
+ * @enum ELoggerRepresentation
+ * @brief The formatted forms of a record a sink can consume.
+ */
+enum class ELoggerRepresentation : uint8
+{
+	None	 = 0,
+
+	/** "[Level]\tContext: Message" as TCHARs, without a line terminator. */
+	Text	 = 1 << 0,
+
+	/** The text form as UTF‑8, terminated by a newline. */
+	Utf8Line = 1 << 1,
+
+	/** A JSON object as UTF‑8, terminated by a newline. */
+	JsonLine = 1 << 2
+};
+ENUM_CLASS_FLAGS(ELoggerRepresentation);
+
+/** An immutable, reference counted text representation shared by every sink that consumes it. */
+using FLoggerSharedText = TSharedRef<const FString, ESPMode::ThreadSafe>;
+
+/** An immutable, reference counted UTF‑8 representation shared by every sink that consumes it. */
+using FLoggerSharedBytes = TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe>;
+
+/**
+ * @struct FLoggerRecord
+ * @brief A record that passed the gate, before formatting.
+ *
+ * Only valid for the duration of the dispatch. Sinks that keep records must copy what they need.
+ */
+struct FLoggerRecord
+{
+	ELoggerLevel Level;
+
+	/** The calling object. May be null. */
+	const UObject* Caller;
+
+	/** The resolved name of the caller, e.g. "Owner.Component". */
+	const FString& ContextName;
+
+	const FString& Message;
+
+	/** The time the record was emitted. */
+	FDateTime Time;
+
+	/** "[Level]\tContext: ", cached per caller and level. */
+	const FString& Prefix;
+
+	/** The prefix as UTF‑8. */
+	const TArray<uint8>& Utf8Prefix;
+
+	/** The net mode of the caller, e.g. "Server" or "Client 2". */
+	const FString& NetLabel;
+};
+
+/**
+ * @struct FLoggerFormattedRecord
+ * @brief The representations of a record. Only the ones requested by some sink are set.
+ */
+struct FLoggerFormattedRecord
+{
+	TSharedPtr<const FString, ESPMode::ThreadSafe> Text;
+	TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Utf8Line;
+	TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> JsonLine;
+};
+
+/**
+ * @class ILoggerSink
+ * @brief An output of the logger library.
+ *
+ * Each record is formatted at most once per representation, and the same buffers are handed to
+ * every sink. Sinks may be called from any thread that logs.
+ */
+class GRONKUTILS_API ILoggerSink
+{
+public:
+	virtual ~ILoggerSink() = default;
+
+	/** @return The representations this sink consumes. */
+	virtual ELoggerRepresentation GetRepresentations() const = 0;
+
+	/**
+	 * @brief Writes a record.
+	 *
+	 * @param Record	The record.
+	 * @param Formatted	The representations of the record, including every one this sink consumes.
+	 */
+	virtual void Write(const FLoggerRecord& Record, const FLoggerFormattedRecord& Formatted) = 0;
+
+	/**
+	 * @brief Does any periodic work, such as flushing buffered records.
+	 *
+	 * @param DeltaTime The number of seconds since the last tick.
+	 */
+	virtual void Tick(float DeltaTime) {}
+
+	/**
+	 * @brief Writes out anything buffered.
+	 */
+	virtual void Flush() {}
+};
+
+/**
+ * @struct FLoggerDispatchStats
+ * @brief Totals of the records dispatched to sinks.
+ */
+struct FLoggerDispatchStats
+{
+	/** The number of records dispatched. */
+	uint64 Records = 0;
+
+	/** The number of bytes formatted for them, over every representation. */
+	uint64 BytesFormatted = 0;
+};
+
+/**
+ * @class FLoggerSinks
+ * @brief The registry of sinks, and the dispatcher that formats records for them.
+ */
+class GRONKUTILS_API FLoggerSinks
+{
+public:
+	/**
+	 * @brief Adds a sink that receives every emitted record.
+	 *
+	 * @param Sink The sink to add.
+	 */
+	static void AddSink(const TSharedRef<ILoggerSink, ESPMode::ThreadSafe>& Sink);
+
+	/**
+	 * @brief Removes a sink added with AddSink, flushing it first.
+	 *
+	 * @param Sink The sink to remove.
+	 */
+	static void RemoveSink(const TSharedRef<ILoggerSink, ESPMode::ThreadSafe>& Sink);
+
+	/**
+	 * @brief Enables or disables one of the built‑in outputs.
+	 *
+	 * @param Output	The output.
+	 * @param bEnabled	Whether the output receives records.
+	 */
+	static void SetOutputEnabled(ELoggerOutput Output, bool bEnabled);
+
+	/**
+	 * @brief Formats a record once per representation needed and writes it to every sink.
+	 *
+	 * @param Record The record to write.
+	 * @return The number of bytes formatted.
+	 */
+	static uint64 Dispatch(const FLoggerRecord& Record);
+
+	/** @return The totals of every record dispatched so far, over all threads. */
+	static FLoggerDispatchStats GetDispatchStats();
+
+	/**
+	 * @brief Ticks every sink.
+	 *
+	 * @param DeltaTime The number of seconds since the last tick.
+	 */
+	static void Tick(float DeltaTime);
+
+	/**
+	 * @brief Flushes every sink.
+	 */
+	static void Flush();
+
+	/**
+	 * @brief Flushes and releases every sink.
+	 */
+	static void Shutdown();
+};
@@ -0,0 +1,138 @@
+/**
+ * @file		LoggerTrace.h
+ * @brief		Captures the stream of logging calls into a compact trace for offline replay.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoggerLibrary.h"
+#include <atomic>
+
+/**
+ * @enum ELoggerTraceCall
+ * @brief The logging function a traced call went through, which implies the type of its value.
+ */
+enum class ELoggerTraceCall : uint8
+{
+	Message,
+	Bool,
+	Int,
+	Float,
+	Vector,
+	Rotator,
+	Transform,
+	Object,
+
+	Num
+};
+
+/**
+ * @struct FLoggerTraceEvent
+ * @brief One traced call. Strings are indices into the trace's string table.
+ */
+struct FLoggerTraceEvent
+{
+	/** The number of microseconds since the previous call. */
+	uint32 DeltaMicroseconds = 0;
+
+	ELoggerTraceCall Call = ELoggerTraceCall::Message;
+
+	ELoggerLevel Level = ELoggerLevel::Display;
+
+	/** The path of the caller's class. */
+	int32 ClassIndex = INDEX_NONE;
+
+	/** The message passed to the function, before any value is appended. */
+	int32 TemplateIndex = INDEX_NONE;
+};
+
+/**
+ * @struct FLoggerTraceData
+ * @brief A loaded trace.
+ */
+struct FLoggerTraceData
+{
+	TArray<FString> Strings;
+	TArray<FLoggerTraceEvent> Events;
+};
+
+/**
+ * @class FLoggerTrace
+ * @brief Records every call into the logging functions while capturing, and loads recorded traces.
+ *
+ * Values are not recorded, only their types. Strings are interned and written once, and each call
+ * costs a tag byte and three variable length integers, so traces of long sessions stay small.
+ * While not capturing, the logging functions pay for one atomic load.
+ */
+class GRONKUTILS_API FLoggerTrace
+{
+public:
+	/**
+	 * @brief Starts capturing calls.
+	 *
+	 * @param FilePath The file to write when capturing stops, or empty for Saved/Logs/GronkUtils/Trace-<timestamp>.gltrace.
+	 * @return True if capturing started, false if it was already running.
+	 */
+	static bool Start(const FString& FilePath = FString());
+
+	/**
+	 * @brief Stops capturing and writes the trace.
+	 *
+	 * @return The path of the written file, or empty if nothing was written.
+	 */
+	static FString Stop();
+
+	/** @return True while calls are being captured. */
+	static bool IsCapturing() { return bCapturing.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Records a call.
+	 *
+	 * @param Call		The function called.
+	 * @param Caller	The calling object.
+	 * @param Template	The message passed to the function.
+	 * @param Level		Log level of the call.
+	 */
+	static void Capture(ELoggerTraceCall Call, const UObject* Caller, const FString& Template, ELoggerLevel Level);
+
+	/**
+	 * @brief Loads a trace written by Stop.
+	 *
+	 * @param FilePath	The file to load.
+	 * @param OutTrace	The loaded trace.
+	 * @return True if the file was a valid trace.
+	 */
+	static bool Load(const FString& FilePath, FLoggerTraceData& OutTrace);
+
+private:
+	/**
+	 * @brief Gets the index of a string, writing its definition the first time. Must be called with the lock held.
+	 *
+	 * @param String The string.
+	 * @return The index of the string.
+	 */
+	static int32 InternString(const FString& String);
+
+	/** Whether calls are being captured. */
+	inline static std::atomic<bool> bCapturing { false };
+
+	/** The encoded calls so far. */
+	inline static TArray<uint8> Buffer;
+
+	/** The index of every string written so far. */
+	inline static TMap<FString, int32> StringIndices;
+
+	/** The file the trace is written to. */
+	inline static FString OutputPath;
+
+	/** The time of the previous call, in cycles. */
+	inline static uint64 LastCycles = 0;
+
+	/** Whether calls were dropped because the trace reached its size limit. */
+	inline static bool bTruncated = false;
+
+	/** Guards the capture state. */
+	inline static FCriticalSection Lock;
+};
@@ -0,0 +1,160 @@
+/**
+ * @file		LoggerWatchSubsystem.h
+ * @brief		A world subsystem that watches objects and logs when they change.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoggerLibrary.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "LoggerWatchSubsystem.generated.h"
+
+/**
+ * @class ULoggerWatchSubsystem
+ * @brief Sweeps all registered watches once per frame and logs only on transitions.
+ *
+ * This replaces per‑tick polling from Blueprint with a single native sweep per world.
+ */
+UCLASS()
+class GRONKUTILS_API ULoggerWatchSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UTickableWorldSubsystem Interface
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End UTickableWorldSubsystem Interface
+
+	/**
+	 * @brief Starts watching an object and logs a message once when it becomes invalid.
+	 *
+	 * Watching an object the caller is already watching replaces the message and level.
+	 *
+	 * @param Caller	The calling object.
+	 * @param InObject	The object to watch.
+	 * @param Message	The message to log when the object becomes invalid.
+	 * @param Level		Log level of the message.
+	 */
+	void WatchObjectValidity(UObject* Caller, UObject* InObject, const FString& Message, ELoggerLevel Level);
+
+	/**
+	 * @brief Stops watching an object without logging.
+	 *
+	 * @param Caller	The calling object.
+	 * @param InObject	The object to stop watching.
+	 */
+	void StopWatchingObjectValidity(UObject* Caller, UObject* InObject);
+
+	/** @return The number of objects currently being watched for validity. */
+	int32 GetNumValidityWatches() const { return WatchedObjects.Num(); }
+
+	/**
+	 * @brief Starts watching a property and logs its value whenever it changes.
+	 *
+	 * The path is resolved once into a memory offset, so each frame only costs a comparison against
+	 * the last seen value. Nested struct members are separated with dots, e.g. "Stats.Health".
+	 *
+	 * @param Caller		The calling object.
+	 * @param InObject		The object that owns the property.
+	 * @param PropertyPath	The dot separated path of the property.
+	 * @param Level			Log level of the messages.
+	 * @return True if the path resolved to a property.
+	 */
+	bool WatchProperty(UObject* Caller, UObject* InObject, const FString& PropertyPath, ELoggerLevel Level);
+
+	/**
+	 * @brief Stops watching a property without logging.
+	 *
+	 * @param Caller		The calling object.
+	 * @param InObject		The object that owns the property.
+	 * @param PropertyPath	The dot separated path of the property.
+	 */
+	void StopWatchingProperty(UObject* Caller, UObject* InObject, const FString& PropertyPath);
+
+	/** @return The number of properties currently being watched. */
+	int32 GetNumPropertyWatches() const { return PropertyWatches.Num(); }
+
+private:
+	/**
+	 * @struct FValidityWatch
+	 * @brief The data needed to log a validity transition, kept apart from the swept pointers.
+	 */
+	struct FValidityWatch
+	{
+		TWeakObjectPtr<UObject> Caller;
+		FString Message;
+		ELoggerLevel Level;
+	};
+
+	/** The key identifying a watch by its caller and watched object. */
+	using FValidityWatchKey = TPair<FObjectKey, FObjectKey>;
+
+	/**
+	 * @brief Sweeps the validity watches, logging any whose object became invalid.
+	 */
+	void SweepValidityWatches();
+
+	/**
+	 * @brief Removes the watch at the given index, keeping the arrays packed.
+	 *
+	 * @param Index The index of the watch to remove.
+	 */
+	void RemoveValidityWatchAt(int32 Index);
+
+	/** The watched objects, packed so the sweep only touches weak pointers. */
+	TArray<TWeakObjectPtr<UObject>> WatchedObjects;
+
+	/** The keys of the watches, parallel to WatchedObjects. */
+	TArray<FValidityWatchKey> WatchKeys;
+
+	/** The logging data of the watches, parallel to WatchedObjects. */
+	TArray<FValidityWatch> Watches;
+
+	/** Maps each watch key to its index in the packed arrays. */
+	TMap<FValidityWatchKey, int32> WatchIndices;
+
+	/**
+	 * @struct FPropertyWatch
+	 * @brief A resolved property and a snapshot of its last seen value.
+	 */
+	struct FPropertyWatch
+	{
+		TWeakObjectPtr<UObject> Object;
+		TWeakObjectPtr<UObject> Caller;
+
+		/** The property at the end of the path. */
+		const FProperty* Property = nullptr;
+
+		/** The offset of the property from the start of the object. */
+		int32 Offset = 0;
+
+		/** Whether the value can be compared with memcmp instead of FProperty::Identical. */
+		bool bPlainOldData = false;
+
+		/** The value of the property when it was last logged. */
+		TArray<uint8, TAlignedHeapAllocator<16>> Snapshot;
+
+		FString PropertyPath;
+		ELoggerLevel Level = ELoggerLevel::Display;
+	};
+
+	/**
+	 * @brief Sweeps the property watches, logging any that changed since the last frame.
+	 */
+	void SweepPropertyWatches();
+
+	/**
+	 * @brief Removes the property watch at the given index, releasing its snapshot.
+	 *
+	 * @param Index The index of the watch to remove.
+	 */
+	void RemovePropertyWatchAt(int32 Index);
+
+	/** The registered property watches. */
+	TArray<FPropertyWatch> PropertyWatches;
+};
@@ -0,0 +1,49 @@
+/**
+ * @file 		GronkUtilsEditor.Build.cs
+ * @brief 		The module rules for the GronkUtilsEditor module.
+ * @copyright 	Grant Wilk, all rights reserved.
+ */
+
+using UnrealBuildTool;
+using System.IO;
+
+
+public class GronkUtilsEditor : ModuleRules
+{
+	public GronkUtilsEditor(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicIncludePaths.AddRange(
+			new string[] {
+				Path.Combine(ModuleDirectory, "Public"),
+			}
+		);
+		PrivateIncludePaths.AddRange(
+			new string[] {
+				Path.Combine(ModuleDirectory, "Private")
+			}
+		);
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"BlueprintGraph"
+			}
+		);
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"GronkUtils",
+				"Json",
+				"KismetCompiler",
+				"Projects",
+				"UnrealEd",
+				"Slate",
+				"SlateCore"
+			}
+		);
+	}
+}
@@ -0,0 +1,46 @@
+/**
+ * @file 		GronkUtilsEditor.cpp
+ * @brief 		The editor module for the GronkUtils plugin.
+ * @copyright 	Grant Wilk, all rights reserved.
+ */
+
+#include "GronkUtilsEditor.h"
+#include "Editor.h"
+#include "LoggerLibrary.h"
+#include "Misc/CoreDelegates.h"
+
+void FGronkUtilsEditorModule::StartupModule()
+{
+	PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FGronkUtilsEditorModule::OnPostEngineInit);
+
+	// Latches are keyed by bytecode address, so they must not carry over into the next PIE session.
+	EndPIEHandle = FEditorDelegates::EndPIE.AddLambda([](const bool bIsSimulating)
+	{
+		ULoggerLibrary::ResetLogOnceLatches();
+	});
+}
+
+void FGronkUtilsEditorModule::ShutdownModule()
+{
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	FEditorDelegates::EndPIE.Remove(EndPIEHandle);
+
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+}
+
+void FGronkUtilsEditorModule::OnPostEngineInit()
+{
+	if (GEditor)
+	{
+		// A recompile can reuse the bytecode address of an old node for a new one that never logged.
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddLambda([]()
+		{
+			ULoggerLibrary::ResetLogOnceLatches();
+		});
+	}
+}
+
+IMPLEMENT_MODULE(FGronkUtilsEditorModule, GronkUtilsEditor)
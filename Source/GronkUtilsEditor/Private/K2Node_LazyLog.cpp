@@ -0,0 +1,294 @@
+/**
+ * @file		K2Node_LazyLog.cpp
+ * @brief		Blueprint nodes that only evaluate their message when it will be logged.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "K2Node_LazyLog.h"
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_Self.h"
+#include "KismetCompiler.h"
+#include "Styling/AppStyle.h"
+#include "LoggerLibrary.h"
+
+#define LOCTEXT_NAMESPACE "K2Node_LazyLog"
+
+const FName UK2Node_LazyLogBase::CallerPinName(TEXT("Caller"));
+const FName UK2Node_LazyLogBase::MessagePinName(TEXT("Message"));
+const FName UK2Node_LazyLogBase::LevelPinName(TEXT("Level"));
+
+// The names of the pins specific to the validity and condition nodes.
+static const FName InObjectPinName(TEXT("InObject"));
+static const FName ConditionPinName(TEXT("Condition"));
+static const FName LogConditionPinName(TEXT("LogCondition"));
+
+void UK2Node_LazyLogBase::AllocateDefaultPins()
+{
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Execute);
+
+	UEdGraphPin* CallerPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Object, UObject::StaticClass(), CallerPinName);
+	CallerPin->PinToolTip = LOCTEXT("CallerTooltip", "The calling object. Defaults to self when left unconnected.").ToString();
+
+	AllocateConditionPins();
+
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_String, MessagePinName);
+
+	UEnum* LevelEnum = StaticEnum<ELoggerLevel>();
+	UEdGraphPin* LevelPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Byte, LevelEnum, LevelPinName);
+	LevelPin->DefaultValue = LevelEnum->GetNameStringByValue(static_cast<int64>(ELoggerLevel::Display));
+
+	if (HasOutcomePins())
+	{
+		FName TrueName, FalseName;
+		FText TrueText, FalseText;
+		GetOutcomePinNames(TrueName, FalseName);
+		GetOutcomePinTexts(TrueText, FalseText);
+
+		UEdGraphPin* TruePin = CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, TrueName);
+		TruePin->PinFriendlyName = TrueText;
+		UEdGraphPin* FalsePin = CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, FalseName);
+		FalsePin->PinFriendlyName = FalseText;
+	}
+	else
+	{
+		CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Then);
+	}
+
+	Super::AllocateDefaultPins();
+}
+
+FLinearColor UK2Node_LazyLogBase::GetNodeTitleColor() const
+{
+	return GetDefault<UEdGraphSchema_K2>()->FunctionCallNodeTitleColor;
+}
+
+FSlateIcon UK2Node_LazyLogBase::GetIconAndTint(FLinearColor& OutColor) const
+{
+	static const FSlateIcon Icon(FAppStyle::GetAppStyleSetName(), "Kismet.AllClasses.FunctionIcon");
+	return Icon;
+}
+
+void UK2Node_LazyLogBase::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	Super::ExpandNode(CompilerContext, SourceGraph);
+
+	const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
+	bool bIsErrorFree = true;
+
+	// Spawn the gate call, the branch on its result, and the log call on the true path.
+	UK2Node_CallFunction* GateNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+	GateNode->FunctionReference.SetExternalMember(GetGateFunctionName(), ULoggerLibrary::StaticClass());
+	GateNode->AllocateDefaultPins();
+
+	UK2Node_IfThenElse* GateBranchNode = CompilerContext.SpawnIntermediateNode<UK2Node_IfThenElse>(this, SourceGraph);
+	GateBranchNode->AllocateDefaultPins();
+
+	UK2Node_CallFunction* LogNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+	LogNode->FunctionReference.SetExternalMember(GET_FUNCTION_NAME_CHECKED(ULoggerLibrary, LogMessage), ULoggerLibrary::StaticClass());
+	LogNode->AllocateDefaultPins();
+
+	bIsErrorFree &= CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *GateNode->GetExecPin()).CanSafeConnect();
+	bIsErrorFree &= Schema->TryCreateConnection(GateNode->GetThenPin(), GateBranchNode->GetExecPin());
+	bIsErrorFree &= Schema->TryCreateConnection(GateNode->GetReturnValuePin(), GateBranchNode->GetConditionPin());
+	bIsErrorFree &= Schema->TryCreateConnection(GateBranchNode->GetThenPin(), LogNode->GetExecPin());
+
+	// An unconnected caller means self, for both the gate and the log call.
+	UEdGraphPin* CallerPin = GetCallerPin();
+	if (CallerPin->LinkedTo.Num() == 0)
+	{
+		UK2Node_Self* SelfNode = CompilerContext.SpawnIntermediateNode<UK2Node_Self>(this, SourceGraph);
+		SelfNode->AllocateDefaultPins();
+
+		UEdGraphPin* SelfPin = SelfNode->FindPinChecked(UEdGraphSchema_K2::PN_Self);
+		bIsErrorFree &= Schema->TryCreateConnection(SelfPin, GateNode->FindPinChecked(CallerPinName, EGPD_Input));
+		bIsErrorFree &= Schema->TryCreateConnection(SelfPin, LogNode->FindPinChecked(CallerPinName, EGPD_Input));
+	}
+
+	// Feed every data input to the gate and log calls that take it. The message is only taken by
+	// the log call, so its graph is only evaluated behind the branch.
+	for (UEdGraphPin* Pin : Pins)
+	{
+		if (Pin->Direction != EGPD_Input || Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+		{
+			continue;
+		}
+		if (Pin == CallerPin && CallerPin->LinkedTo.Num() == 0)
+		{
+			continue;
+		}
+
+		if (UEdGraphPin* GatePin = GateNode->FindPin(Pin->PinName, EGPD_Input))
+		{
+			bIsErrorFree &= CompilerContext.CopyPinLinksToIntermediate(*Pin, *GatePin).CanSafeConnect();
+		}
+		if (UEdGraphPin* LogPin = LogNode->FindPin(Pin->PinName, EGPD_Input))
+		{
+			bIsErrorFree &= CompilerContext.CopyPinLinksToIntermediate(*Pin, *LogPin).CanSafeConnect();
+		}
+	}
+
+	if (HasOutcomePins())
+	{
+		// Both the logged and the suppressed paths rejoin at a branch on the gate's outcome, which the
+		// gate already evaluated so the condition graph only runs once.
+		UK2Node_IfThenElse* OutcomeBranchNode = CompilerContext.SpawnIntermediateNode<UK2Node_IfThenElse>(this, SourceGraph);
+		OutcomeBranchNode->AllocateDefaultPins();
+
+		bIsErrorFree &= Schema->TryCreateConnection(LogNode->GetThenPin(), OutcomeBranchNode->GetExecPin());
+		bIsErrorFree &= Schema->TryCreateConnection(GateBranchNode->GetElsePin(), OutcomeBranchNode->GetExecPin());
+		bIsErrorFree &= Schema->TryCreateConnection(GateNode->FindPinChecked(GetGateOutcomeParamName(), EGPD_Output), OutcomeBranchNode->GetConditionPin());
+
+		FName TrueName, FalseName;
+		GetOutcomePinNames(TrueName, FalseName);
+		bIsErrorFree &= CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(TrueName, EGPD_Output), *OutcomeBranchNode->GetThenPin()).CanSafeConnect();
+		bIsErrorFree &= CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(FalseName, EGPD_Output), *OutcomeBranchNode->GetElsePin()).CanSafeConnect();
+	}
+	else
+	{
+		UEdGraphPin* ThenPin = FindPinChecked(UEdGraphSchema_K2::PN_Then, EGPD_Output);
+		bIsErrorFree &= CompilerContext.CopyPinLinksToIntermediate(*ThenPin, *GateBranchNode->GetElsePin()).CanSafeConnect();
+		bIsErrorFree &= CompilerContext.MovePinLinksToIntermediate(*ThenPin, *LogNode->GetThenPin()).CanSafeConnect();
+	}
+
+	if (!bIsErrorFree)
+	{
+		CompilerContext.MessageLog.Error(*LOCTEXT("InternalConnectionError", "@@ failed to expand its internal nodes.").ToString(), this);
+	}
+
+	BreakAllNodeLinks();
+}
+
+void UK2Node_LazyLogBase::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	UClass* ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+		check(NodeSpawner != nullptr);
+
+		ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+	}
+}
+
+FText UK2Node_LazyLogBase::GetMenuCategory() const
+{
+	return LOCTEXT("MenuCategory", "GronkUtils|Logging");
+}
+
+UEdGraphPin* UK2Node_LazyLogBase::GetCallerPin() const
+{
+	return FindPinChecked(CallerPinName, EGPD_Input);
+}
+
+UEdGraphPin* UK2Node_LazyLogBase::GetMessagePin() const
+{
+	return FindPinChecked(MessagePinName, EGPD_Input);
+}
+
+UEdGraphPin* UK2Node_LazyLogBase::GetLevelPin() const
+{
+	return FindPinChecked(LevelPinName, EGPD_Input);
+}
+
+FText UK2Node_LazyLogMessage::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("LazyLogMessageTitle", "Log Message (Lazy)");
+}
+
+FText UK2Node_LazyLogMessage::GetTooltipText() const
+{
+	return LOCTEXT("LazyLogMessageTooltip", "Logs a message to the output log.\nThe message is only built when the level is not suppressed.");
+}
+
+FName UK2Node_LazyLogMessage::GetGateFunctionName() const
+{
+	return GET_FUNCTION_NAME_CHECKED(ULoggerLibrary, ShouldLogMessage);
+}
+
+FText UK2Node_LazyLogOnValidity::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("LazyLogOnValidityTitle", "Log On Validity (Lazy)");
+}
+
+FText UK2Node_LazyLogOnValidity::GetTooltipText() const
+{
+	return LOCTEXT("LazyLogOnValidityTooltip", "Checks an object for validity and logs a message based on the specified validity condition.\nThe message is only built when it will be logged.");
+}
+
+FName UK2Node_LazyLogOnValidity::GetGateFunctionName() const
+{
+	return GET_FUNCTION_NAME_CHECKED(ULoggerLibrary, ShouldLogOnValidity);
+}
+
+void UK2Node_LazyLogOnValidity::AllocateConditionPins()
+{
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Object, UObject::StaticClass(), InObjectPinName);
+
+	UEnum* ConditionEnum = StaticEnum<ELogValidityCondition>();
+	UEdGraphPin* LogConditionPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Byte, ConditionEnum, LogConditionPinName);
+	LogConditionPin->DefaultValue = ConditionEnum->GetNameStringByValue(static_cast<int64>(ELogValidityCondition::LogWhenInvalid));
+}
+
+FName UK2Node_LazyLogOnValidity::GetGateOutcomeParamName() const
+{
+	return TEXT("bOutIsValid");
+}
+
+void UK2Node_LazyLogOnValidity::GetOutcomePinNames(FName& OutTrueName, FName& OutFalseName) const
+{
+	OutTrueName = TEXT("IsValid");
+	OutFalseName = TEXT("IsNotValid");
+}
+
+void UK2Node_LazyLogOnValidity::GetOutcomePinTexts(FText& OutTrueText, FText& OutFalseText) const
+{
+	OutTrueText = LOCTEXT("IsValid", "Is Valid");
+	OutFalseText = LOCTEXT("IsNotValid", "Is Not Valid");
+}
+
+FText UK2Node_LazyLogOnCondition::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("LazyLogOnConditionTitle", "Log On Condition (Lazy)");
+}
+
+FText UK2Node_LazyLogOnCondition::GetTooltipText() const
+{
+	return LOCTEXT("LazyLogOnConditionTooltip", "Checks a boolean condition and logs a message based on the condition's value.\nThe message is only built when it will be logged.");
+}
+
+FName UK2Node_LazyLogOnCondition::GetGateFunctionName() const
+{
+	return GET_FUNCTION_NAME_CHECKED(ULoggerLibrary, ShouldLogOnCondition);
+}
+
+void UK2Node_LazyLogOnCondition::AllocateConditionPins()
+{
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Boolean, ConditionPinName);
+
+	UEnum* ConditionEnum = StaticEnum<ELogBooleanCondition>();
+	UEdGraphPin* LogConditionPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Byte, ConditionEnum, LogConditionPinName);
+	LogConditionPin->DefaultValue = ConditionEnum->GetNameStringByValue(static_cast<int64>(ELogBooleanCondition::LogWhenTrue));
+}
+
+FName UK2Node_LazyLogOnCondition::GetGateOutcomeParamName() const
+{
+	return TEXT("bOutCondition");
+}
+
+void UK2Node_LazyLogOnCondition::GetOutcomePinNames(FName& OutTrueName, FName& OutFalseName) const
+{
+	OutTrueName = TEXT("IsTrue");
+	OutFalseName = TEXT("IsFalse");
+}
+
+void UK2Node_LazyLogOnCondition::GetOutcomePinTexts(FText& OutTrueText, FText& OutFalseText) const
+{
+	OutTrueText = LOCTEXT("IsTrue", "True");
+	OutFalseText = LOCTEXT("IsFalse", "False");
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,51 @@
+/**
+ * @file		K2Node_LogOnce.cpp
+ * @brief		Blueprint nodes that only log the first time they are reached.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "K2Node_LogOnce.h"
+#include "EdGraphSchema_K2.h"
+#include "LoggerLibrary.h"
+
+#define LOCTEXT_NAMESPACE "K2Node_LogOnce"
+
+// The name of the pin of the object the message is about.
+static const FName InObjectPinName(TEXT("InObject"));
+
+FText UK2Node_LogOnce::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("LogOnceTitle", "Log Once");
+}
+
+FText UK2Node_LogOnce::GetTooltipText() const
+{
+	return LOCTEXT("LogOnceTooltip", "Logs a message the first time this node would emit it, and never again.\nThe message is only built when it will be logged.");
+}
+
+FName UK2Node_LogOnce::GetGateFunctionName() const
+{
+	return GET_FUNCTION_NAME_CHECKED(ULoggerLibrary, ShouldLogOnce);
+}
+
+FText UK2Node_LogOncePerObject::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("LogOncePerObjectTitle", "Log Once Per Object");
+}
+
+FText UK2Node_LogOncePerObject::GetTooltipText() const
+{
+	return LOCTEXT("LogOncePerObjectTooltip", "Logs a message the first time this node would emit it for each object.\nThe message is only built when it will be logged.");
+}
+
+FName UK2Node_LogOncePerObject::GetGateFunctionName() const
+{
+	return GET_FUNCTION_NAME_CHECKED(ULoggerLibrary, ShouldLogOncePerObject);
+}
+
+void UK2Node_LogOncePerObject::AllocateConditionPins()
+{
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Object, UObject::StaticClass(), InObjectPinName);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,356 @@
+/**
+ * @file		LoggerBenchmarkCommandlet.cpp
+ * @brief		Runs the logging benchmark suite and gates it against a baseline.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerBenchmarkCommandlet.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPluginManager.h"
+#include "LoggerAllocationScope.h"
+#include "LoggerLibrary.h"
+#include "LoggerSink.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogLoggerBenchmark, Log, All);
+
+// The exit codes of the commandlet.
+static constexpr int32 ExitSuccess = 0;
+static constexpr int32 ExitRegression = 1;
+static constexpr int32 ExitError = 2;
+
+/**
+ * @struct FBenchmarkScenario
+ * @brief One workload of the suite.
+ */
+struct FBenchmarkScenario
+{
+	const TCHAR* Name;
+
+	/** The outputs enabled while the scenario runs. Every other output is disabled. */
+	TArray<ELoggerOutput> Outputs;
+
+	/** Makes one call into the library. */
+	TFunction<void(UObject* Caller, int32 Iteration)> Call;
+};
+
+/**
+ * @struct FBenchmarkMetric
+ * @brief A measured metric and how far it may regress.
+ */
+struct FBenchmarkMetric
+{
+	const TCHAR* Name;
+
+	/** The default fraction of the baseline a metric may grow by. */
+	double RelativeTolerance;
+
+	/** The default amount a metric may grow by on top of the relative tolerance. */
+	double AbsoluteTolerance;
+};
+
+// The metrics of every scenario. Timings are noisy, so they get room. Allocations and bytes are
+// deterministic, so any growth is a regression.
+static const FBenchmarkMetric Metrics[] = {
+	{ TEXT("nsPerCall"), 0.25, 2.0 },
+	{ TEXT("allocationsPerCall"), 0.0, 0.01 },
+	{ TEXT("bytesPerRecord"), 0.0, 0.5 }
+};
+
+/** @return The scenarios of the suite. */
+static TArray<FBenchmarkScenario> MakeScenarios()
+{
+	TArray<FBenchmarkScenario> Scenarios;
+
+	Scenarios.Add({ TEXT("GatedOut"), {}, [](UObject* Caller, int32 Iteration)
+	{
+		ULoggerLibrary::LogMessage(Caller, TEXT("Benchmark message below every threshold"), ELoggerLevel::VeryVerbose);
+	} });
+	Scenarios.Add({ TEXT("MessageNoOutputs"), {}, [](UObject* Caller, int32 Iteration)
+	{
+		ULoggerLibrary::LogMessage(Caller, TEXT("Benchmark message formatted for no sink"), ELoggerLevel::Display);
+	} });
+	Scenarios.Add({ TEXT("MessageToFile"), { ELoggerOutput::File }, [](UObject* Caller, int32 Iteration)
+	{
+		ULoggerLibrary::LogMessage(Caller, TEXT("Benchmark message written to the text file"), ELoggerLevel::Display);
+	} });
+	Scenarios.Add({ TEXT("MessageToJson"), { ELoggerOutput::Json }, [](UObject* Caller, int32 Iteration)
+	{
+		ULoggerLibrary::LogMessage(Caller, TEXT("Benchmark message written to the \"JSON\" file"), ELoggerLevel::Display);
+	} });
+	Scenarios.Add({ TEXT("IntToFile"), { ELoggerOutput::File }, [](UObject* Caller, int32 Iteration)
+	{
+		ULoggerLibrary::LogInt(Caller, TEXT("Benchmark int"), Iteration, ELoggerLevel::Display);
+	} });
+	Scenarios.Add({ TEXT("FloatToFile"), { ELoggerOutput::File }, [](UObject* Caller, int32 Iteration)
+	{
+		ULoggerLibrary::LogFloat(Caller, TEXT("Benchmark float"), Iteration * 0.25, ELoggerLevel::Display);
+	} });
+	Scenarios.Add({ TEXT("VectorToFile"), { ELoggerOutput::File }, [](UObject* Caller, int32 Iteration)
+	{
+		ULoggerLibrary::LogVector(Caller, TEXT("Benchmark vector"), FVector(Iteration, -Iteration, Iteration * 0.5), ELoggerLevel::Display);
+	} });
+
+	return Scenarios;
+}
+
+/**
+ * @brief Enables exactly the given outputs.
+ *
+ * @param Outputs The outputs to enable.
+ */
+static void SetOutputs(const TArray<ELoggerOutput>& Outputs)
+{
+	const UEnum* OutputEnum = StaticEnum<ELoggerOutput>();
+	for (int32 Index = 0; Index < OutputEnum->NumEnums() - 1; ++Index)
+	{
+		const ELoggerOutput Output = static_cast<ELoggerOutput>(OutputEnum->GetValueByIndex(Index));
+		ULoggerLibrary::SetOutputEnabled(Output, Outputs.Contains(Output));
+	}
+}
+
+/**
+ * @brief Runs a scenario and measures it.
+ *
+ * @param Scenario		The scenario.
+ * @param Caller		The object to call as.
+ * @param Iterations	The number of calls per run.
+ * @param Runs			The number of runs. The timing of the median run is kept.
+ * @return The metrics of the scenario.
+ */
+static TSharedRef<FJsonObject> RunScenario(const FBenchmarkScenario& Scenario, UObject* Caller, int32 Iterations, int32 Runs)
+{
+	SetOutputs(Scenario.Outputs);
+
+	// Warm up caches, lazily created sinks and files before anything is measured.
+	for (int32 Iteration = 0; Iteration < FMath::Min(Iterations, 1000); ++Iteration)
+	{
+		Scenario.Call(Caller, Iteration);
+	}
+	FLoggerSinks::Flush();
+
+	TArray<double> NsPerCallRuns;
+	uint64 Allocations = 0;
+	const FLoggerDispatchStats DispatchBefore = FLoggerSinks::GetDispatchStats();
+
+	for (int32 Run = 0; Run < Runs; ++Run)
+	{
+		FLoggerAllocationScope AllocationScope;
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Scenario.Call(Caller, Iteration);
+		}
+		const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+
+		Allocations += AllocationScope.GetNumAllocations();
+		NsPerCallRuns.Add(FPlatformTime::ToSeconds64(Cycles) * 1e9 / Iterations);
+	}
+
+	const FLoggerDispatchStats DispatchAfter = FLoggerSinks::GetDispatchStats();
+	FLoggerSinks::Flush();
+
+	NsPerCallRuns.Sort();
+	const uint64 Records = DispatchAfter.Records - DispatchBefore.Records;
+	const uint64 Bytes = DispatchAfter.BytesFormatted - DispatchBefore.BytesFormatted;
+
+	TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetNumberField(TEXT("nsPerCall"), NsPerCallRuns[NsPerCallRuns.Num() / 2]);
+	Result->SetNumberField(TEXT("allocationsPerCall"), static_cast<double>(Allocations) / (static_cast<double>(Iterations) * Runs));
+	Result->SetNumberField(TEXT("bytesPerRecord"), Records > 0 ? static_cast<double>(Bytes) / Records : 0.0);
+	return Result;
+}
+
+/**
+ * @brief Compares results against a baseline and logs a readable diff.
+ *
+ * @param Results	The results of every scenario.
+ * @param Baseline	The baseline document.
+ * @return True if no metric regressed past its tolerance.
+ */
+static bool CompareToBaseline(const TSharedRef<FJsonObject>& Results, const TSharedPtr<FJsonObject>& Baseline)
+{
+	const TSharedPtr<FJsonObject>* BaselineScenarios = nullptr;
+	Baseline->TryGetObjectField(TEXT("scenarios"), BaselineScenarios);
+	const TSharedPtr<FJsonObject>* Tolerances = nullptr;
+	Baseline->TryGetObjectField(TEXT("tolerances"), Tolerances);
+
+	bool bPassed = true;
+	UE_LOG(LogLoggerBenchmark, Display, TEXT("%-20s %-20s %12s %12s %9s %9s  %s"), TEXT("Scenario"), TEXT("Metric"), TEXT("Baseline"), TEXT("Current"), TEXT("Change"), TEXT("Allowed"), TEXT("Status"));
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& ScenarioPair : Results->Values)
+	{
+		const TSharedPtr<FJsonObject>& Current = ScenarioPair.Value->AsObject();
+		const TSharedPtr<FJsonObject>* BaselineScenario = nullptr;
+		if (!BaselineScenarios || !(*BaselineScenarios)->TryGetObjectField(ScenarioPair.Key, BaselineScenario))
+		{
+			UE_LOG(LogLoggerBenchmark, Display, TEXT("%-20s %-20s %12s %12s %9s %9s  %s"), *ScenarioPair.Key, TEXT("*"), TEXT("-"), TEXT("-"), TEXT("-"), TEXT("-"), TEXT("NEW"));
+			continue;
+		}
+
+		for (const FBenchmarkMetric& Metric : Metrics)
+		{
+			double BaselineValue = 0.0;
+			if (!(*BaselineScenario)->TryGetNumberField(Metric.Name, BaselineValue))
+			{
+				continue;
+			}
+			const double CurrentValue = Current->GetNumberField(Metric.Name);
+
+			// A baseline may override the tolerance of a metric, e.g. "nsPerCall": { "relative": 0.1, "absolute": 1 }.
+			double Relative = Metric.RelativeTolerance;
+			double Absolute = Metric.AbsoluteTolerance;
+			const TSharedPtr<FJsonObject>* Tolerance = nullptr;
+			if (Tolerances && (*Tolerances)->TryGetObjectField(Metric.Name, Tolerance))
+			{
+				(*Tolerance)->TryGetNumberField(TEXT("relative"), Relative);
+				(*Tolerance)->TryGetNumberField(TEXT("absolute"), Absolute);
+			}
+
+			const double Allowed = BaselineValue * (1.0 + Relative) + Absolute;
+			const bool bRegressed = CurrentValue > Allowed;
+			const double Change = BaselineValue != 0.0 ? (CurrentValue - BaselineValue) / BaselineValue * 100.0 : 0.0;
+			bPassed &= !bRegressed;
+
+			UE_LOG(LogLoggerBenchmark, Display, TEXT("%-20s %-20s %12.2f %12.2f %+8.1f%% %9.2f  %s"),
+				*ScenarioPair.Key, Metric.Name, BaselineValue, CurrentValue, Change, Allowed,
+				bRegressed ? TEXT("REGRESSED") : (CurrentValue < BaselineValue ? TEXT("improved") : TEXT("ok")));
+		}
+	}
+
+	return bPassed;
+}
+
+/**
+ * @brief Writes a JSON document to a file.
+ *
+ * @param Object	The document.
+ * @param FilePath	The file to write.
+ * @return True if the file was written.
+ */
+static bool SaveJson(const TSharedRef<FJsonObject>& Object, const FString& FilePath)
+{
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Object, Writer);
+	return FFileHelper::SaveStringToFile(Json, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+ULoggerBenchmarkCommandlet::ULoggerBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 ULoggerBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString BaselinePath;
+	if (!FParse::Value(*Params, TEXT("Baseline="), BaselinePath))
+	{
+		const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("GronkUtils"));
+		if (!Plugin)
+		{
+			UE_LOG(LogLoggerBenchmark, Error, TEXT("Could not find the GronkUtils plugin. Pass -Baseline=<File>."));
+			return ExitError;
+		}
+		BaselinePath = FPaths::Combine(Plugin->GetBaseDir(), TEXT("Benchmarks"), TEXT("LoggerBaseline.json"));
+	}
+
+	int32 Iterations = 100000;
+	int32 Runs = 5;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	FParse::Value(*Params, TEXT("Runs="), Runs);
+	Iterations = FMath::Max(Iterations, 1);
+	Runs = FMath::Max(Runs, 1);
+
+	UObject* Caller = GetTransientPackage();
+
+	TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+	for (const FBenchmarkScenario& Scenario : MakeScenarios())
+	{
+		Results->SetObjectField(Scenario.Name, RunScenario(Scenario, Caller, Iterations, Runs));
+	}
+
+	// Leave the outputs as a fresh session would have them.
+	SetOutputs({ ELoggerOutput::OutputLog, ELoggerOutput::OnScreen });
+
+	FString OutputPath;
+	if (FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		TSharedRef<FJsonObject> Document = MakeShared<FJsonObject>();
+		Document->SetObjectField(TEXT("scenarios"), Results);
+		if (!SaveJson(Document, OutputPath))
+		{
+			UE_LOG(LogLoggerBenchmark, Error, TEXT("Failed to write the results to %s"), *OutputPath);
+			return ExitError;
+		}
+	}
+
+	// Load the baseline, keeping its tolerances if the baseline is being rewritten.
+	TSharedPtr<FJsonObject> Baseline;
+	FString BaselineJson;
+	if (FFileHelper::LoadFileToString(BaselineJson, *BaselinePath))
+	{
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BaselineJson);
+		if (!FJsonSerializer::Deserialize(Reader, Baseline) || !Baseline.IsValid())
+		{
+			UE_LOG(LogLoggerBenchmark, Error, TEXT("The baseline %s is not valid JSON"), *BaselinePath);
+			return ExitError;
+		}
+	}
+
+	if (FParse::Param(*Params, TEXT("WriteBaseline")))
+	{
+		TSharedRef<FJsonObject> Document = MakeShared<FJsonObject>();
+		TSharedRef<FJsonObject> Tolerances = MakeShared<FJsonObject>();
+		const TSharedPtr<FJsonObject>* ExistingTolerances = nullptr;
+		for (const FBenchmarkMetric& Metric : Metrics)
+		{
+			const TSharedPtr<FJsonObject>* Existing = nullptr;
+			if (Baseline.IsValid() && Baseline->TryGetObjectField(TEXT("tolerances"), ExistingTolerances) && (*ExistingTolerances)->TryGetObjectField(Metric.Name, Existing))
+			{
+				Tolerances->SetObjectField(Metric.Name, *Existing);
+				continue;
+			}
+			TSharedRef<FJsonObject> Tolerance = MakeShared<FJsonObject>();
+			Tolerance->SetNumberField(TEXT("relative"), Metric.RelativeTolerance);
+			Tolerance->SetNumberField(TEXT("absolute"), Metric.AbsoluteTolerance);
+			Tolerances->SetObjectField(Metric.Name, Tolerance);
+		}
+		Document->SetObjectField(TEXT("tolerances"), Tolerances);
+		Document->SetObjectField(TEXT("scenarios"), Results);
+
+		if (!SaveJson(Document, BaselinePath))
+		{
+			UE_LOG(LogLoggerBenchmark, Error, TEXT("Failed to write the baseline to %s"), *BaselinePath);
+			return ExitError;
+		}
+		UE_LOG(LogLoggerBenchmark, Display, TEXT("Wrote the baseline to %s"), *BaselinePath);
+		return ExitSuccess;
+	}
+
+	if (!Baseline.IsValid())
+	{
+		UE_LOG(LogLoggerBenchmark, Error, TEXT("No baseline at %s. Record one on the build agent with -WriteBaseline."), *BaselinePath);
+		return ExitError;
+	}
+
+	if (!CompareToBaseline(Results, Baseline))
+	{
+		UE_LOG(LogLoggerBenchmark, Error, TEXT("The logging benchmarks regressed against %s"), *BaselinePath);
+		return ExitRegression;
+	}
+
+	UE_LOG(LogLoggerBenchmark, Display, TEXT("The logging benchmarks are within tolerance of %s"), *BaselinePath);
+	return ExitSuccess;
+}
@@ -0,0 +1,594 @@
+/**
+ * @file		LoggerDiffCommandlet.cpp
+ * @brief		Finds where the logs of two runs diverge.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerDiffCommandlet.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Hash/CityHash.h"
+#include "LoggerLogReader.h"
+#include "Misc/Parse.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogLoggerDiff, Log, All);
+
+// The exit codes of the commandlet, following diff.
+static constexpr int32 ExitSame = 0;
+static constexpr int32 ExitDifferent = 1;
+static constexpr int32 ExitError = 2;
+
+// The fewest records read and hashed at once, so the parallel hashing has enough work to split.
+static constexpr int32 MinReadBatch = 4096;
+
+/**
+ * @brief Checks that a run of characters are all digits.
+ *
+ * @return True if Chars[Start, Start + Count) are digits within Len.
+ */
+static bool AreDigits(const TCHAR* Chars, int32 Len, int32 Start, int32 Count)
+{
+	if (Start + Count > Len)
+	{
+		return false;
+	}
+	for (int32 Index = Start; Index < Start + Count; ++Index)
+	{
+		if (!FChar::IsDigit(Chars[Index]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Matches a time of day such as "12:34:56" or "12:34:56.789".
+ *
+ * @param Chars			The characters to match at.
+ * @param Len			The number of characters available.
+ * @param bAllowDots	Whether dots may separate the fields, as in the engine's "12.34.56:789".
+ * @return The length of the match, or zero.
+ */
+static int32 MatchTime(const TCHAR* Chars, int32 Len, bool bAllowDots)
+{
+	const bool bSeparator = Len >= 3 && (Chars[2] == TEXT(':') || (bAllowDots && Chars[2] == TEXT('.')));
+	if (!bSeparator || !AreDigits(Chars, Len, 0, 2) || !AreDigits(Chars, Len, 3, 2) || Len < 8 || Chars[5] != Chars[2] || !AreDigits(Chars, Len, 6, 2))
+	{
+		return 0;
+	}
+
+	int32 End = 8;
+	if (End + 1 < Len && (Chars[End] == TEXT('.') || Chars[End] == TEXT(',') || Chars[End] == TEXT(':')) && FChar::IsDigit(Chars[End + 1]))
+	{
+		End += 2;
+		while (End < Len && FChar::IsDigit(Chars[End]))
+		{
+			++End;
+		}
+	}
+	return End;
+}
+
+/**
+ * @brief Matches a timestamp such as "2024-01-02T12:34:56.789Z", "2024.01.02-12.34.56:789" or "12:34:56".
+ *
+ * @param Chars	The characters to match at.
+ * @param Len	The number of characters available.
+ * @return The length of the match, or zero.
+ */
+static int32 MatchTimestamp(const TCHAR* Chars, int32 Len)
+{
+	const bool bDate = AreDigits(Chars, Len, 0, 4) && Len >= 10
+		&& (Chars[4] == TEXT('-') || Chars[4] == TEXT('.') || Chars[4] == TEXT('/'))
+		&& AreDigits(Chars, Len, 5, 2) && Chars[7] == Chars[4] && AreDigits(Chars, Len, 8, 2);
+	if (!bDate)
+	{
+		return MatchTime(Chars, Len, false);
+	}
+
+	int32 End = 10;
+	if (End < Len && (Chars[End] == TEXT('T') || Chars[End] == TEXT(' ') || Chars[End] == TEXT('-') || Chars[End] == TEXT('_')))
+	{
+		if (const int32 TimeLength = MatchTime(Chars + End + 1, Len - End - 1, true))
+		{
+			End += 1 + TimeLength;
+			if (End < Len && Chars[End] == TEXT('Z'))
+			{
+				++End;
+			}
+		}
+	}
+	return End;
+}
+
+/** @return True if the character can be part of an object name. */
+static bool IsNameChar(TCHAR Char)
+{
+	return FChar::IsAlnum(Char) || Char == TEXT('_');
+}
+
+/**
+ * @brief Appends text with its timestamps masked and the numeric suffixes of object names stripped.
+ *
+ * @param Out	The string to append to.
+ * @param Text	The text to normalize.
+ */
+static void AppendNormalized(FString& Out, const FString& Text)
+{
+	const TCHAR* Chars = *Text;
+	const int32 Len = Text.Len();
+
+	for (int32 Index = 0; Index < Len;)
+	{
+		const bool bTokenStart = Index == 0 || !FChar::IsDigit(Chars[Index - 1]);
+		if (bTokenStart && FChar::IsDigit(Chars[Index]))
+		{
+			if (const int32 TimestampLength = MatchTimestamp(Chars + Index, Len - Index))
+			{
+				Out.Append(TEXT("<time>"));
+				Index += TimestampLength;
+				continue;
+			}
+		}
+
+		// Drop the suffix the engine numbers object names with, e.g. "BP_Enemy_C_12" becomes "BP_Enemy_C".
+		if (Chars[Index] == TEXT('_') && Index > 0 && IsNameChar(Chars[Index - 1]) && Index + 1 < Len && FChar::IsDigit(Chars[Index + 1]))
+		{
+			int32 End = Index + 1;
+			while (End < Len && FChar::IsDigit(Chars[End]))
+			{
+				++End;
+			}
+			if (End == Len || !IsNameChar(Chars[End]))
+			{
+				Index = End;
+				continue;
+			}
+		}
+
+		Out.AppendChar(Chars[Index]);
+		++Index;
+	}
+}
+
+/**
+ * @brief Hashes the normalized form of a record.
+ *
+ * @param Line The record.
+ * @return The hash.
+ */
+static uint64 HashRecord(const FLoggerLogLine& Line)
+{
+	FString Normalized;
+	Normalized.Reserve(Line.Net.Len() + Line.Context.Len() + Line.Message.Len() + 8);
+	Normalized.AppendInt(static_cast<int32>(Line.Level));
+	Normalized.AppendChar(TEXT('\t'));
+	Normalized.Append(Line.Net);
+	Normalized.AppendChar(TEXT('\t'));
+	AppendNormalized(Normalized, Line.Context);
+	Normalized.Append(TEXT(": "));
+	AppendNormalized(Normalized, Line.Message);
+	return CityHash64(reinterpret_cast<const char*>(*Normalized), Normalized.Len() * sizeof(TCHAR));
+}
+
+/**
+ * @struct FDiffRecord
+ * @brief A buffered record and the hash it is compared by.
+ */
+struct FDiffRecord
+{
+	FLoggerLogLine Line;
+	uint64 Hash = 0;
+
+	/** The one based position of the record in its log. */
+	int64 Number = 0;
+};
+
+/**
+ * @class FDiffSide
+ * @brief One of the logs being compared, buffered a window at a time.
+ */
+class FDiffSide
+{
+public:
+	explicit FDiffSide(const FString& FilePath)
+		: Stream(FilePath)
+	{
+	}
+
+	/** @return True if the log was opened. */
+	bool IsValid() const { return Stream.IsValid(); }
+
+	/** @return The number of buffered records. */
+	int32 Num() const { return Records.Num() - Front; }
+
+	const FDiffRecord& operator[](int32 Index) const { return Records[Front + Index]; }
+
+	/** @return The number of the first buffered record, or of the next record to read. */
+	int64 GetFrontNumber() const { return Num() > 0 ? (*this)[0].Number : NextNumber; }
+
+	/**
+	 * @brief Reads and hashes records until at least the given number are buffered or the log ends.
+	 *
+	 * @param Count The number of records to buffer.
+	 */
+	void Fill(int32 Count)
+	{
+		if (bEnded || Num() >= Count)
+		{
+			return;
+		}
+
+		Records.RemoveAt(0, Front, false);
+		Front = 0;
+
+		// Reading is sequential, but normalizing and hashing the batch is spread over the task graph.
+		const int32 First = Records.Num();
+		const int32 NumToRead = FMath::Max(Count - Num(), MinReadBatch);
+		while (Records.Num() - First < NumToRead)
+		{
+			FDiffRecord& Record = Records.AddDefaulted_GetRef();
+			if (!Stream.Next(Record.Line))
+			{
+				Records.Pop(false);
+				bEnded = true;
+				break;
+			}
+			Record.Number = NextNumber++;
+		}
+
+		ParallelFor(Records.Num() - First, [this, First](int32 Index)
+		{
+			FDiffRecord& Record = Records[First + Index];
+			Record.Hash = HashRecord(Record.Line);
+		});
+	}
+
+	/**
+	 * @brief Drops records from the front of the buffer.
+	 *
+	 * @param Count The number of records to drop.
+	 */
+	void Consume(int32 Count)
+	{
+		Front += Count;
+	}
+
+	/** @return The number of invalid lines skipped so far. */
+	int32 GetNumInvalid() const { return Stream.GetNumInvalid(); }
+
+private:
+	FLoggerLogStream Stream;
+	TArray<FDiffRecord> Records;
+
+	/** The index of the first unconsumed record in Records. */
+	int32 Front = 0;
+
+	int64 NextNumber = 1;
+	bool bEnded = false;
+};
+
+/**
+ * @brief Finds where two windows that differ at their front line up again.
+ *
+ * Like patience diff, the records that occur exactly once in each window are matched, and the
+ * longest run of them in the same order in both is taken as the alignment. Its first record is
+ * the anchor. If no record is unique, the common record closest to the front of both is used.
+ *
+ * @param A		The first log.
+ * @param NumA	The size of the window of the first log.
+ * @param B		The second log.
+ * @param NumB	The size of the window of the second log.
+ * @param OutA	The position of the anchor in the first window.
+ * @param OutB	The position of the anchor in the second window.
+ * @return False if the windows have no record in common.
+ */
+static bool FindAnchor(const FDiffSide& A, int32 NumA, const FDiffSide& B, int32 NumB, int32& OutA, int32& OutB)
+{
+	struct FOccurrences
+	{
+		int32 CountA = 0;
+		int32 CountB = 0;
+		int32 FirstB = INDEX_NONE;
+	};
+
+	TMap<uint64, FOccurrences> Occurrences;
+	Occurrences.Reserve(NumA + NumB);
+	for (int32 Index = 0; Index < NumA; ++Index)
+	{
+		++Occurrences.FindOrAdd(A[Index].Hash).CountA;
+	}
+	for (int32 Index = 0; Index < NumB; ++Index)
+	{
+		FOccurrences& Found = Occurrences.FindOrAdd(B[Index].Hash);
+		if (Found.CountB++ == 0)
+		{
+			Found.FirstB = Index;
+		}
+	}
+
+	// The records unique to both windows, in the order of the first window.
+	TArray<TPair<int32, int32>> Unique;
+	for (int32 Index = 0; Index < NumA; ++Index)
+	{
+		const FOccurrences& Found = Occurrences.FindChecked(A[Index].Hash);
+		if (Found.CountA == 1 && Found.CountB == 1)
+		{
+			Unique.Add({ Index, Found.FirstB });
+		}
+	}
+
+	if (Unique.Num() > 0)
+	{
+		// Patience sorting: Tails[Length - 1] is the unique record ending the lowest increasing run of that length.
+		TArray<int32> Tails;
+		TArray<int32> Previous;
+		Previous.SetNumUninitialized(Unique.Num());
+		for (int32 Index = 0; Index < Unique.Num(); ++Index)
+		{
+			int32 Low = 0;
+			int32 High = Tails.Num();
+			while (Low < High)
+			{
+				const int32 Middle = (Low + High) / 2;
+				if (Unique[Tails[Middle]].Value < Unique[Index].Value)
+				{
+					Low = Middle + 1;
+				}
+				else
+				{
+					High = Middle;
+				}
+			}
+
+			Previous[Index] = Low > 0 ? Tails[Low - 1] : INDEX_NONE;
+			if (Low == Tails.Num())
+			{
+				Tails.Add(Index);
+			}
+			else
+			{
+				Tails[Low] = Index;
+			}
+		}
+
+		int32 First = Tails.Last();
+		while (Previous[First] != INDEX_NONE)
+		{
+			First = Previous[First];
+		}
+		OutA = Unique[First].Key;
+		OutB = Unique[First].Value;
+		return true;
+	}
+
+	bool bFound = false;
+	int32 BestDistance = MAX_int32;
+	for (int32 Index = 0; Index < NumA && Index < BestDistance; ++Index)
+	{
+		const FOccurrences& Found = Occurrences.FindChecked(A[Index].Hash);
+		if (Found.CountB > 0 && Index + Found.FirstB < BestDistance)
+		{
+			BestDistance = Index + Found.FirstB;
+			OutA = Index;
+			OutB = Found.FirstB;
+			bFound = true;
+		}
+	}
+	return bFound;
+}
+
+/**
+ * @class FDiffReport
+ * @brief Writes divergences to the log, and to a file if one was given.
+ */
+class FDiffReport
+{
+public:
+	/**
+	 * @param OutputPath	The file to write every divergence to, or empty.
+	 * @param InMaxLogged	The most divergences written to the log.
+	 * @param InContext		The most records shown per side of a divergence.
+	 */
+	FDiffReport(const FString& OutputPath, int32 InMaxLogged, int32 InContext)
+		: MaxLogged(InMaxLogged)
+		, Context(InContext)
+	{
+		if (!OutputPath.IsEmpty())
+		{
+			File.Reset(IFileManager::Get().CreateFileWriter(*OutputPath));
+		}
+	}
+
+	/** @return True if the output file was requested and could not be opened. */
+	bool HasFileError(const FString& OutputPath) const { return !OutputPath.IsEmpty() && !File; }
+
+	/**
+	 * @brief Reports records at the front of both logs that do not line up.
+	 *
+	 * @param A		The first log.
+	 * @param NumA	The number of differing records at the front of the first log.
+	 * @param B		The second log.
+	 * @param NumB	The number of differing records at the front of the second log.
+	 */
+	void AddDivergence(const FDiffSide& A, int32 NumA, const FDiffSide& B, int32 NumB)
+	{
+		const bool bLog = NumDivergences < MaxLogged;
+		++NumDivergences;
+		if (NumDivergences == 1)
+		{
+			FirstA = A.GetFrontNumber();
+			FirstB = B.GetFrontNumber();
+		}
+		if (!bLog && !File)
+		{
+			return;
+		}
+
+		Write(bLog, FString::Printf(TEXT("@@ A #%lld (%d records) | B #%lld (%d records) @@"), A.GetFrontNumber(), NumA, B.GetFrontNumber(), NumB));
+		WriteSide(bLog, TEXT("- "), A, NumA);
+		WriteSide(bLog, TEXT("+ "), B, NumB);
+	}
+
+	/**
+	 * @brief Writes a line to the file, and to the log if asked to.
+	 *
+	 * @param bLog Whether to write the line to the log.
+	 * @param Line The line.
+	 */
+	void Write(bool bLog, const FString& Line)
+	{
+		if (bLog)
+		{
+			UE_LOG(LogLoggerDiff, Display, TEXT("%s"), *Line);
+		}
+		if (File)
+		{
+			const FTCHARToUTF8 Utf8(*Line, Line.Len());
+			File->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+			File->Serialize(const_cast<ANSICHAR*>("\n"), 1);
+		}
+	}
+
+	int64 NumDivergences = 0;
+	int64 FirstA = 0;
+	int64 FirstB = 0;
+
+private:
+	/**
+	 * @brief Writes the differing records of one side.
+	 *
+	 * @param bLog		Whether to write to the log.
+	 * @param Marker	The marker of the side.
+	 * @param Side		The log.
+	 * @param Num		The number of differing records.
+	 */
+	void WriteSide(bool bLog, const TCHAR* Marker, const FDiffSide& Side, int32 Num)
+	{
+		const UEnum* LevelEnum = StaticEnum<ELoggerLevel>();
+		for (int32 Index = 0; Index < FMath::Min(Num, Context); ++Index)
+		{
+			const FLoggerLogLine& Line = Side[Index].Line;
+			Write(bLog, FString::Printf(TEXT("%s[%s] %s: %s"), Marker, *LevelEnum->GetNameStringByValue(static_cast<int64>(Line.Level)), *Line.Context, *Line.Message));
+		}
+		if (Num > Context)
+		{
+			Write(bLog, FString::Printf(TEXT("%s... %d more"), Marker, Num - Context));
+		}
+	}
+
+	TUniquePtr<FArchive> File;
+	int32 MaxLogged;
+	int32 Context;
+};
+
+ULoggerDiffCommandlet::ULoggerDiffCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 ULoggerDiffCommandlet::Main(const FString& Params)
+{
+	FString PathA;
+	FString PathB;
+	if (!FParse::Value(*Params, TEXT("A="), PathA) || !FParse::Value(*Params, TEXT("B="), PathB))
+	{
+		UE_LOG(LogLoggerDiff, Error, TEXT("Usage: -run=LoggerDiff -A=<File> -B=<File> [-Window=<N>] [-Context=<N>] [-MaxHunks=<N>] [-Output=<File>]"));
+		return ExitError;
+	}
+
+	int32 Window = 8192;
+	int32 Context = 5;
+	int32 MaxHunks = 50;
+	FString OutputPath;
+	FParse::Value(*Params, TEXT("Window="), Window);
+	FParse::Value(*Params, TEXT("Context="), Context);
+	FParse::Value(*Params, TEXT("MaxHunks="), MaxHunks);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	Window = FMath::Max(Window, 16);
+
+	FDiffSide A(PathA);
+	FDiffSide B(PathB);
+	if (!A.IsValid() || !B.IsValid())
+	{
+		UE_LOG(LogLoggerDiff, Error, TEXT("Could not open %s"), A.IsValid() ? *PathB : *PathA);
+		return ExitError;
+	}
+
+	FDiffReport Report(OutputPath, MaxHunks, Context);
+	if (Report.HasFileError(OutputPath))
+	{
+		UE_LOG(LogLoggerDiff, Error, TEXT("Could not open %s for writing"), *OutputPath);
+		return ExitError;
+	}
+
+	int64 NumMatching = 0;
+	while (true)
+	{
+		A.Fill(Window);
+		B.Fill(Window);
+
+		// Most of two similar runs lines up, so skip matching records without building anything.
+		int32 NumCommon = 0;
+		const int32 MaxCommon = FMath::Min(A.Num(), B.Num());
+		while (NumCommon < MaxCommon && A[NumCommon].Hash == B[NumCommon].Hash)
+		{
+			++NumCommon;
+		}
+		if (NumCommon > 0)
+		{
+			A.Consume(NumCommon);
+			B.Consume(NumCommon);
+			NumMatching += NumCommon;
+			continue;
+		}
+
+		if (A.Num() == 0 && B.Num() == 0)
+		{
+			break;
+		}
+
+		// The logs diverge here. Align the next window of each to find where they meet again.
+		const int32 NumA = FMath::Min(A.Num(), Window);
+		const int32 NumB = FMath::Min(B.Num(), Window);
+		int32 AnchorA = NumA;
+		int32 AnchorB = NumB;
+		if (NumA > 0 && NumB > 0 && FindAnchor(A, NumA, B, NumB, AnchorA, AnchorB))
+		{
+			// Records just before the anchor that match belong to the aligned run, not the divergence.
+			while (AnchorA > 0 && AnchorB > 0 && A[AnchorA - 1].Hash == B[AnchorB - 1].Hash)
+			{
+				--AnchorA;
+				--AnchorB;
+			}
+		}
+
+		Report.AddDivergence(A, AnchorA, B, AnchorB);
+		A.Consume(AnchorA);
+		B.Consume(AnchorB);
+	}
+
+	const int32 NumInvalid = A.GetNumInvalid() + B.GetNumInvalid();
+	if (NumInvalid > 0)
+	{
+		UE_LOG(LogLoggerDiff, Warning, TEXT("Skipped %d invalid JSON lines"), NumInvalid);
+	}
+
+	if (Report.NumDivergences == 0)
+	{
+		UE_LOG(LogLoggerDiff, Display, TEXT("The logs match (%lld records)"), NumMatching);
+		return ExitSame;
+	}
+
+	UE_LOG(LogLoggerDiff, Display, TEXT("The logs diverge at %lld points, first at A #%lld and B #%lld (%lld records match)"),
+		Report.NumDivergences, Report.FirstA, Report.FirstB, NumMatching);
+	if (Report.NumDivergences > MaxHunks)
+	{
+		UE_LOG(LogLoggerDiff, Display, TEXT("Only the first %d divergences were logged%s"), MaxHunks, OutputPath.IsEmpty() ? TEXT(". Pass -Output=<File> to write all of them.") : TEXT(""));
+	}
+	return ExitDifferent;
+}
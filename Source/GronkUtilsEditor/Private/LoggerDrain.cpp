@@ -0,0 +1,115 @@
+/**
+ * @file		LoggerDrain.cpp
+ * @brief		Drain, an online log template miner built on a fixed depth parse tree.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerDrain.h"
+
+FLoggerDrain::FLoggerDrain(int32 InDepth, double InSimilarity, int32 InMaxChildren)
+	: Depth(FMath::Max(InDepth, 3))
+	, Similarity(FMath::Clamp(InSimilarity, 0.0, 1.0))
+	, MaxChildren(FMath::Max(InMaxChildren, 1))
+{
+}
+
+void FLoggerDrain::Tokenize(const FString& Message, TArray<FString>& OutTokens)
+{
+	OutTokens.Reset();
+	Message.ParseIntoArrayWS(OutTokens);
+	for (FString& Token : OutTokens)
+	{
+		for (const TCHAR Char : Token)
+		{
+			if (FChar::IsDigit(Char))
+			{
+				Token = Wildcard;
+				break;
+			}
+		}
+	}
+}
+
+FLoggerDrain::FNode& FLoggerDrain::FindLeaf(const TArray<FString>& Tokens)
+{
+	FNode* Node = &LengthNodes.FindOrAdd(Tokens.Num());
+
+	const int32 NumRoutingTokens = FMath::Min(Depth - 2, Tokens.Num());
+	for (int32 Index = 0; Index < NumRoutingTokens; ++Index)
+	{
+		// Once a node is full, tokens it has not seen are routed as variables.
+		const FString& Token = Tokens[Index];
+		const FString Key = Node->Children.Contains(Token) || Node->Children.Num() < MaxChildren ? Token : FString(Wildcard);
+		TUniquePtr<FNode>& Child = Node->Children.FindOrAdd(Key);
+		if (!Child)
+		{
+			Child = MakeUnique<FNode>();
+		}
+		Node = Child.Get();
+	}
+
+	return *Node;
+}
+
+void FLoggerDrain::Add(const FString& Message, const FString& Context)
+{
+	TArray<FString> Tokens;
+	Tokenize(Message, Tokens);
+
+	FNode& Leaf = FindLeaf(Tokens);
+
+	// Find the most similar cluster. A variable in the template only matches a variable in the
+	// message, so templates that have already generalized do not swallow unrelated messages, while
+	// messages masked to variables by Tokenize still match their own template. Ties go to the
+	// cluster with more variables, as in Drain3.
+	int32 BestIndex = INDEX_NONE;
+	double BestSimilarity = -1.0;
+	int32 BestNumVariables = -1;
+	for (const int32 ClusterIndex : Leaf.ClusterIndices)
+	{
+		const TArray<FString>& Template = Clusters[ClusterIndex].Tokens;
+		int32 NumMatching = 0;
+		int32 NumVariables = 0;
+		for (int32 Index = 0; Index < Tokens.Num(); ++Index)
+		{
+			const bool bVariable = Template[Index] == Wildcard;
+			NumVariables += bVariable ? 1 : 0;
+			if (Template[Index] == Tokens[Index] || (bVariable && Tokens[Index] == Wildcard))
+			{
+				++NumMatching;
+			}
+		}
+
+		const double ClusterSimilarity = Tokens.Num() > 0 ? static_cast<double>(NumMatching) / Tokens.Num() : 1.0;
+		if (ClusterSimilarity > BestSimilarity || (ClusterSimilarity == BestSimilarity && NumVariables > BestNumVariables))
+		{
+			BestSimilarity = ClusterSimilarity;
+			BestNumVariables = NumVariables;
+			BestIndex = ClusterIndex;
+		}
+	}
+
+	if (BestIndex == INDEX_NONE || BestSimilarity < Similarity)
+	{
+		BestIndex = Clusters.AddDefaulted();
+		Clusters[BestIndex].Tokens = Tokens;
+		Clusters[BestIndex].Example = Message;
+		Leaf.ClusterIndices.Add(BestIndex);
+	}
+	else
+	{
+		TArray<FString>& Template = Clusters[BestIndex].Tokens;
+		for (int32 Index = 0; Index < Tokens.Num(); ++Index)
+		{
+			if (Template[Index] != Tokens[Index])
+			{
+				Template[Index] = Wildcard;
+			}
+		}
+	}
+
+	FLoggerDrainCluster& Cluster = Clusters[BestIndex];
+	++Cluster.Count;
+	Cluster.Bytes += FTCHARToUTF8(*Message, Message.Len()).Length();
+	++Cluster.Contexts.FindOrAdd(Context);
+}
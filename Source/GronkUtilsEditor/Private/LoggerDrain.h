@@ -0,0 +1,107 @@
+/**
+ * @file		LoggerDrain.h
+ * @brief		Drain, an online log template miner built on a fixed depth parse tree.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @struct FLoggerDrainCluster
+ * @brief A group of messages that share a template.
+ */
+struct FLoggerDrainCluster
+{
+	/** The tokens of the template. Tokens that vary between messages are FLoggerDrain::Wildcard. */
+	TArray<FString> Tokens;
+
+	/** The number of messages in the cluster. */
+	uint64 Count = 0;
+
+	/** The number of UTF‑8 bytes of the messages in the cluster. */
+	uint64 Bytes = 0;
+
+	/** The first message added to the cluster. */
+	FString Example;
+
+	/** The number of messages each context logged into the cluster. */
+	TMap<FString, uint64> Contexts;
+
+	/** @return The template as a string. */
+	FString GetTemplate() const { return FString::Join(Tokens, TEXT(" ")); }
+};
+
+/**
+ * @class FLoggerDrain
+ * @brief Clusters messages into templates with Drain.
+ *
+ * Messages are split into whitespace separated tokens, and any token containing a digit is
+ * treated as a variable up front. The tree routes a message by its token count and then by its
+ * first tokens, so each message is only compared with the few clusters in its leaf. It joins the
+ * most similar one if enough of their tokens match, turning the tokens that differ into variables,
+ * and otherwise starts a new cluster.
+ */
+class FLoggerDrain
+{
+public:
+	/** The token standing in for a variable. */
+	static constexpr const TCHAR* Wildcard = TEXT("<*>");
+
+	/**
+	 * @param InDepth		The depth of the tree. Messages are routed by their first Depth - 2 tokens.
+	 * @param InSimilarity	The share of matching tokens, between 0 and 1, needed to join a cluster.
+	 * @param InMaxChildren	The most children a node has before further tokens are routed as variables.
+	 */
+	FLoggerDrain(int32 InDepth, double InSimilarity, int32 InMaxChildren);
+
+	/**
+	 * @brief Adds a message to its cluster.
+	 *
+	 * @param Message The message.
+	 * @param Context The context that logged the message.
+	 */
+	void Add(const FString& Message, const FString& Context);
+
+	/** @return Every cluster. */
+	const TArray<FLoggerDrainCluster>& GetClusters() const { return Clusters; }
+
+	/**
+	 * @brief Splits a message into tokens, replacing the ones containing a digit with the wildcard.
+	 *
+	 * @param Message	The message.
+	 * @param OutTokens	The tokens.
+	 */
+	static void Tokenize(const FString& Message, TArray<FString>& OutTokens);
+
+private:
+	/**
+	 * @struct FNode
+	 * @brief A node of the parse tree. Leaves hold clusters.
+	 */
+	struct FNode
+	{
+		TMap<FString, TUniquePtr<FNode>> Children;
+
+		/** The indices of the clusters in this leaf. */
+		TArray<int32> ClusterIndices;
+	};
+
+	/**
+	 * @brief Finds the leaf a message is routed to, adding nodes on the way.
+	 *
+	 * @param Tokens The tokens of the message.
+	 * @return The leaf.
+	 */
+	FNode& FindLeaf(const TArray<FString>& Tokens);
+
+	int32 Depth;
+	double Similarity;
+	int32 MaxChildren;
+
+	/** The first layer of the tree, keyed by token count. */
+	TMap<int32, FNode> LengthNodes;
+
+	TArray<FLoggerDrainCluster> Clusters;
+};
@@ -0,0 +1,751 @@
+/**
+ * @file		LoggerExportCommandlet.cpp
+ * @brief		Converts logs into a columnar layout for analytics.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerExportCommandlet.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "LoggerLibrary.h"
+#include "LoggerLogReader.h"
+#include "LoggerTrace.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogLoggerExport, Log, All);
+
+/**
+ * @enum EExportValue
+ * @brief The typed value split off a message, if any.
+ */
+enum class EExportValue : uint8
+{
+	None,
+	Int,
+	Float,
+	Vector
+};
+
+/**
+ * @struct FExportDictionary
+ * @brief The distinct values of a dictionary encoded column, in order of first appearance.
+ */
+struct FExportDictionary
+{
+	TArray<FString> Values;
+	TMap<FString, int32> Indices;
+
+	/**
+	 * @brief Gets the index of a value, adding it the first time.
+	 *
+	 * @param Value The value.
+	 * @return The index of the value.
+	 */
+	int32 Intern(const FString& Value)
+	{
+		if (const int32* Index = Indices.Find(Value))
+		{
+			return *Index;
+		}
+		const int32 Index = Values.Add(Value);
+		Indices.Add(Value, Index);
+		return Index;
+	}
+};
+
+/**
+ * @struct TExportNullableColumn
+ * @brief A column that only has a value in some rows. Values are stored densely, in row order.
+ */
+template <typename T>
+struct TExportNullableColumn
+{
+	/** Whether each row has a value. */
+	TBitArray<> Valid;
+
+	/** The values of the rows that have one. */
+	TArray<T> Values;
+
+	/**
+	 * @brief Adds a row.
+	 *
+	 * @param Value The value of the row, or null.
+	 */
+	void Add(const T* Value)
+	{
+		Valid.Add(Value != nullptr);
+		if (Value)
+		{
+			Values.Add(*Value);
+		}
+	}
+
+	/** @brief Empties the column, keeping its memory for the next row group. */
+	void Reset()
+	{
+		Valid.Reset();
+		Values.Reset();
+	}
+};
+
+/**
+ * @struct FExportRowGroup
+ * @brief The rows of the row group being filled, already split into columns.
+ */
+struct FExportRowGroup
+{
+	/** The level of each row, as its ELoggerLevel value. */
+	TArray<uint8> Levels;
+
+	TArray<int32> Nets;
+	TArray<int32> Contexts;
+	TArray<int32> Templates;
+
+	/** Microseconds since the Unix epoch, or since the start of the capture for traces. */
+	TExportNullableColumn<int64> Times;
+
+	TExportNullableColumn<int32> Ints;
+	TExportNullableColumn<double> Floats;
+	TExportNullableColumn<FVector> Vectors;
+
+	/** @return The number of rows. */
+	int32 Num() const { return Levels.Num(); }
+
+	/** @brief Empties the group, keeping its memory for the next one. */
+	void Reset()
+	{
+		Levels.Reset();
+		Nets.Reset();
+		Contexts.Reset();
+		Templates.Reset();
+		Times.Reset();
+		Ints.Reset();
+		Floats.Reset();
+		Vectors.Reset();
+	}
+};
+
+/**
+ * @brief Splits the value appended by one of the typed logging functions off a message.
+ *
+ * The functions append ": <value>". Integers have no decimal point, floats always have one, and
+ * vectors are written as "X=... Y=... Z=...". Anything else stays part of the template.
+ *
+ * @param Message		The message.
+ * @param OutTemplate	The message without its value.
+ * @param OutInt		The value, if it is an integer.
+ * @param OutFloat		The value, if it is a float.
+ * @param OutVector		The value, if it is a vector.
+ * @return The type of the value that was split off.
+ */
+static EExportValue SplitValue(const FString& Message, FString& OutTemplate, int32& OutInt, double& OutFloat, FVector& OutVector)
+{
+	const int32 Separator = Message.Find(TEXT(": "), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+	if (Separator == INDEX_NONE)
+	{
+		OutTemplate = Message;
+		return EExportValue::None;
+	}
+
+	const FString Value = Message.Mid(Separator + 2);
+	EExportValue Kind = EExportValue::None;
+
+	if (Value.IsNumeric())
+	{
+		int32 DotIndex;
+		if (Value.FindChar(TEXT('.'), DotIndex))
+		{
+			OutFloat = FCString::Atod(*Value);
+			Kind = EExportValue::Float;
+		}
+		else
+		{
+			const int64 Parsed = FCString::Atoi64(*Value);
+			if (Parsed >= MIN_int32 && Parsed <= MAX_int32)
+			{
+				OutInt = static_cast<int32>(Parsed);
+				Kind = EExportValue::Int;
+			}
+		}
+	}
+	else if (Value.StartsWith(TEXT("X="), ESearchCase::CaseSensitive) && OutVector.InitFromString(Value))
+	{
+		Kind = EExportValue::Vector;
+	}
+
+	OutTemplate = Kind == EExportValue::None ? Message : Message.Left(Separator);
+	return Kind;
+}
+
+// Values are written in the byte order of the machine, which is little endian on every platform the editor runs on.
+template <typename T>
+static void AppendValue(TArray<uint8>& Data, const T& Value)
+{
+	Data.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+}
+
+/** @return The number of bytes an index up to the given value is stored in. */
+static int32 GetIndexWidth(int64 MaxIndex)
+{
+	return MaxIndex < 0x100 ? 1 : (MaxIndex < 0x10000 ? 2 : 4);
+}
+
+template <typename T>
+static T ExportMin(const T& A, const T& B) { return FMath::Min(A, B); }
+static FVector ExportMin(const FVector& A, const FVector& B) { return A.ComponentMin(B); }
+
+template <typename T>
+static T ExportMax(const T& A, const T& B) { return FMath::Max(A, B); }
+static FVector ExportMax(const FVector& A, const FVector& B) { return A.ComponentMax(B); }
+
+template <typename T>
+static TSharedRef<FJsonValue> MakeStat(const T& Value) { return MakeShared<FJsonValueNumber>(static_cast<double>(Value)); }
+static TSharedRef<FJsonValue> MakeStat(const FVector& Value)
+{
+	return MakeShared<FJsonValueArray>(TArray<TSharedPtr<FJsonValue>>{
+		MakeShared<FJsonValueNumber>(Value.X), MakeShared<FJsonValueNumber>(Value.Y), MakeShared<FJsonValueNumber>(Value.Z) });
+}
+
+/**
+ * @brief Describes a column in the manifest.
+ *
+ * @param Name			The name of the column, which its files are named after.
+ * @param Type			The type of each stored value.
+ * @param bNullable		Whether the column has a validity file.
+ * @param bDictionary	Whether the column is dictionary encoded.
+ * @return The description of the column.
+ */
+static TSharedRef<FJsonObject> MakeColumn(const FString& Name, const TCHAR* Type, bool bNullable, bool bDictionary)
+{
+	TSharedRef<FJsonObject> Column = MakeShared<FJsonObject>();
+	Column->SetStringField(TEXT("file"), Name + TEXT(".bin"));
+	Column->SetStringField(TEXT("type"), Type);
+	if (bNullable)
+	{
+		Column->SetStringField(TEXT("validity"), Name + TEXT(".valid"));
+	}
+	if (bDictionary)
+	{
+		Column->SetStringField(TEXT("dictionary"), Name + TEXT(".dict.json"));
+	}
+	return Column;
+}
+
+/**
+ * @brief Writes a JSON document to a file.
+ *
+ * @param Value		The document.
+ * @param FilePath	The file to write.
+ * @return True if the file was written.
+ */
+template <typename JsonType>
+static bool SaveJson(const JsonType& Value, const FString& FilePath)
+{
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Value, Writer);
+	return FFileHelper::SaveStringToFile(Json, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+/**
+ * @brief Writes a dictionary as a JSON array of strings.
+ *
+ * @param Values	The values of the dictionary, in index order.
+ * @param FilePath	The file to write.
+ * @return True if the file was written.
+ */
+static bool SaveDictionary(const TArray<FString>& Values, const FString& FilePath)
+{
+	TArray<TSharedPtr<FJsonValue>> JsonValues;
+	JsonValues.Reserve(Values.Num());
+	for (const FString& Value : Values)
+	{
+		JsonValues.Add(MakeShared<FJsonValueString>(Value));
+	}
+	return SaveJson(JsonValues, FilePath);
+}
+
+/**
+ * @class FExportWriter
+ * @brief Splits rows into columns and writes each row group to the column files as soon as it fills.
+ *
+ * Only the dictionaries and the current row group are held in memory, so the size of the inputs
+ * is bounded by disk space rather than by memory or array indices.
+ */
+class FExportWriter
+{
+public:
+	/**
+	 * @param InOutputDir		The directory to write the columns to.
+	 * @param InRowGroupSize	The number of rows per row group.
+	 */
+	FExportWriter(const FString& InOutputDir, int32 InRowGroupSize);
+
+	/**
+	 * @brief Creates the output directory and opens every column file.
+	 *
+	 * @return True if every file was opened.
+	 */
+	bool Open();
+
+	/**
+	 * @brief Adds a row, writing the row group out once it is full.
+	 *
+	 * @param Time			The time of the row, or null if unknown.
+	 * @param Level			The level of the row.
+	 * @param Net			The net mode label of the row.
+	 * @param Context		The context of the row.
+	 * @param Message		The message of the row.
+	 * @param bSplitValue	Whether to split a typed value off the end of the message.
+	 */
+	void AddRow(const int64* Time, ELoggerLevel Level, const FString& Net, const FString& Context, const FString& Message, bool bSplitValue);
+
+	/**
+	 * @brief Writes the last row group, closes the column files, and writes the dictionaries and manifest.
+	 *
+	 * @param Inputs The files the rows were read from.
+	 * @return True if everything was written.
+	 */
+	bool Finish(const TArray<FString>& Inputs);
+
+	/** @brief Logs a summary of what was exported. */
+	void LogSummary() const;
+
+private:
+	/**
+	 * @brief Writes the current row group to the column files and records it in the manifest.
+	 */
+	void WriteRowGroup();
+
+	/**
+	 * @brief Writes the rows of the row group in a dictionary encoded column.
+	 *
+	 * @param File		The column file.
+	 * @param Indices	The dictionary index of every row of the group.
+	 * @param Width		The number of bytes per index, or zero to fit the largest index of the group.
+	 * @return The location and stats of the chunk.
+	 */
+	template <typename IndexType>
+	TSharedRef<FJsonObject> WriteDictionaryChunk(FArchive& File, const TArray<IndexType>& Indices, int32 Width);
+
+	/**
+	 * @brief Writes the rows of the row group in a nullable column, with a byte aligned validity bitmap.
+	 *
+	 * @param File		The column file.
+	 * @param ValidFile	The validity file of the column.
+	 * @param Column	The column of the group.
+	 * @return The location and stats of the chunk.
+	 */
+	template <typename T>
+	TSharedRef<FJsonObject> WriteNullableChunk(FArchive& File, FArchive& ValidFile, const TExportNullableColumn<T>& Column);
+
+	/**
+	 * @brief Opens a column file for writing.
+	 *
+	 * @param FileName The name of the file within the output directory.
+	 * @return The writer, or null if the file could not be created.
+	 */
+	TUniquePtr<FArchive> OpenFile(const TCHAR* FileName) const;
+
+	FString OutputDir;
+	int32 RowGroupSize;
+
+	FExportDictionary NetDictionary;
+	FExportDictionary ContextDictionary;
+	FExportDictionary TemplateDictionary;
+
+	/** The rows not written yet. */
+	FExportRowGroup Group;
+
+	/** The encoded bytes of the chunk being written, reused between chunks. */
+	TArray<uint8> Scratch;
+
+	TUniquePtr<FArchive> LevelFile;
+	TUniquePtr<FArchive> NetFile;
+	TUniquePtr<FArchive> ContextFile;
+	TUniquePtr<FArchive> TemplateFile;
+	TUniquePtr<FArchive> TimeFile;
+	TUniquePtr<FArchive> TimeValidFile;
+	TUniquePtr<FArchive> IntFile;
+	TUniquePtr<FArchive> IntValidFile;
+	TUniquePtr<FArchive> FloatFile;
+	TUniquePtr<FArchive> FloatValidFile;
+	TUniquePtr<FArchive> VectorFile;
+	TUniquePtr<FArchive> VectorValidFile;
+
+	/** The manifest entry of every row group written. */
+	TArray<TSharedPtr<FJsonValue>> RowGroups;
+
+	int64 NumRows = 0;
+	int64 NumInts = 0;
+	int64 NumFloats = 0;
+	int64 NumVectors = 0;
+};
+
+FExportWriter::FExportWriter(const FString& InOutputDir, int32 InRowGroupSize)
+	: OutputDir(InOutputDir)
+	, RowGroupSize(FMath::Max(InRowGroupSize, 1))
+{
+}
+
+TUniquePtr<FArchive> FExportWriter::OpenFile(const TCHAR* FileName) const
+{
+	return TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*FPaths::Combine(OutputDir, FileName)));
+}
+
+bool FExportWriter::Open()
+{
+	IFileManager::Get().MakeDirectory(*OutputDir, true);
+
+	LevelFile = OpenFile(TEXT("level.bin"));
+	NetFile = OpenFile(TEXT("net.bin"));
+	ContextFile = OpenFile(TEXT("context.bin"));
+	TemplateFile = OpenFile(TEXT("template.bin"));
+	TimeFile = OpenFile(TEXT("time.bin"));
+	TimeValidFile = OpenFile(TEXT("time.valid"));
+	IntFile = OpenFile(TEXT("int.bin"));
+	IntValidFile = OpenFile(TEXT("int.valid"));
+	FloatFile = OpenFile(TEXT("float.bin"));
+	FloatValidFile = OpenFile(TEXT("float.valid"));
+	VectorFile = OpenFile(TEXT("vector.bin"));
+	VectorValidFile = OpenFile(TEXT("vector.valid"));
+
+	return LevelFile && NetFile && ContextFile && TemplateFile && TimeFile && TimeValidFile
+		&& IntFile && IntValidFile && FloatFile && FloatValidFile && VectorFile && VectorValidFile;
+}
+
+void FExportWriter::AddRow(const int64* Time, ELoggerLevel Level, const FString& Net, const FString& Context, const FString& Message, bool bSplitValue)
+{
+	FString Template;
+	int32 IntValue = 0;
+	double FloatValue = 0.0;
+	FVector VectorValue = FVector::ZeroVector;
+	EExportValue Kind = EExportValue::None;
+
+	if (bSplitValue)
+	{
+		Kind = SplitValue(Message, Template, IntValue, FloatValue, VectorValue);
+	}
+	else
+	{
+		Template = Message;
+	}
+
+	Group.Levels.Add(static_cast<uint8>(Level));
+	Group.Nets.Add(NetDictionary.Intern(Net));
+	Group.Contexts.Add(ContextDictionary.Intern(Context));
+	Group.Templates.Add(TemplateDictionary.Intern(Template));
+	Group.Times.Add(Time);
+	Group.Ints.Add(Kind == EExportValue::Int ? &IntValue : nullptr);
+	Group.Floats.Add(Kind == EExportValue::Float ? &FloatValue : nullptr);
+	Group.Vectors.Add(Kind == EExportValue::Vector ? &VectorValue : nullptr);
+
+	if (Group.Num() >= RowGroupSize)
+	{
+		WriteRowGroup();
+	}
+}
+
+template <typename IndexType>
+TSharedRef<FJsonObject> FExportWriter::WriteDictionaryChunk(FArchive& File, const TArray<IndexType>& Indices, int32 Width)
+{
+	int64 Min = MAX_int64;
+	int64 Max = MIN_int64;
+	for (const IndexType Index : Indices)
+	{
+		Min = FMath::Min<int64>(Min, Index);
+		Max = FMath::Max<int64>(Max, Index);
+	}
+
+	// Dictionaries only grow, so each chunk is stored as narrow as the indices it holds allow.
+	if (Width == 0)
+	{
+		Width = GetIndexWidth(Max);
+	}
+
+	Scratch.Reset(Indices.Num() * Width);
+	for (const IndexType Index : Indices)
+	{
+		const uint32 Value = static_cast<uint32>(Index);
+		Scratch.Append(reinterpret_cast<const uint8*>(&Value), Width);
+	}
+
+	const int64 Offset = File.Tell();
+	File.Serialize(Scratch.GetData(), Scratch.Num());
+
+	TSharedRef<FJsonObject> Chunk = MakeShared<FJsonObject>();
+	Chunk->SetNumberField(TEXT("offset"), Offset);
+	Chunk->SetNumberField(TEXT("length"), Scratch.Num());
+	Chunk->SetNumberField(TEXT("width"), Width);
+	Chunk->SetNumberField(TEXT("min"), Min);
+	Chunk->SetNumberField(TEXT("max"), Max);
+	return Chunk;
+}
+
+template <typename T>
+TSharedRef<FJsonObject> FExportWriter::WriteNullableChunk(FArchive& File, FArchive& ValidFile, const TExportNullableColumn<T>& Column)
+{
+	const int32 NumGroupRows = Column.Valid.Num();
+
+	TArray<uint8> Validity;
+	Validity.AddZeroed((NumGroupRows + 7) / 8);
+
+	Scratch.Reset(Column.Values.Num() * sizeof(T));
+	int32 Cursor = 0;
+	TOptional<T> Min;
+	TOptional<T> Max;
+
+	for (int32 Row = 0; Row < NumGroupRows; ++Row)
+	{
+		if (!Column.Valid[Row])
+		{
+			continue;
+		}
+
+		Validity[Row / 8] |= 1 << (Row % 8);
+		const T& Value = Column.Values[Cursor++];
+		AppendValue(Scratch, Value);
+		Min = Min.IsSet() ? ExportMin(Min.GetValue(), Value) : Value;
+		Max = Max.IsSet() ? ExportMax(Max.GetValue(), Value) : Value;
+	}
+
+	const int64 Offset = File.Tell();
+	const int64 ValidOffset = ValidFile.Tell();
+	File.Serialize(Scratch.GetData(), Scratch.Num());
+	ValidFile.Serialize(Validity.GetData(), Validity.Num());
+
+	TSharedRef<FJsonObject> Chunk = MakeShared<FJsonObject>();
+	Chunk->SetNumberField(TEXT("offset"), Offset);
+	Chunk->SetNumberField(TEXT("length"), Scratch.Num());
+	Chunk->SetNumberField(TEXT("validOffset"), ValidOffset);
+	Chunk->SetNumberField(TEXT("validLength"), Validity.Num());
+	Chunk->SetNumberField(TEXT("nulls"), NumGroupRows - Column.Values.Num());
+	if (Min.IsSet())
+	{
+		Chunk->SetField(TEXT("min"), MakeStat(Min.GetValue()));
+		Chunk->SetField(TEXT("max"), MakeStat(Max.GetValue()));
+	}
+	return Chunk;
+}
+
+void FExportWriter::WriteRowGroup()
+{
+	if (Group.Num() == 0)
+	{
+		return;
+	}
+
+	TSharedRef<FJsonObject> Chunks = MakeShared<FJsonObject>();
+	Chunks->SetObjectField(TEXT("level"), WriteDictionaryChunk(*LevelFile, Group.Levels, 1));
+	Chunks->SetObjectField(TEXT("net"), WriteDictionaryChunk(*NetFile, Group.Nets, 0));
+	Chunks->SetObjectField(TEXT("context"), WriteDictionaryChunk(*ContextFile, Group.Contexts, 0));
+	Chunks->SetObjectField(TEXT("template"), WriteDictionaryChunk(*TemplateFile, Group.Templates, 0));
+	Chunks->SetObjectField(TEXT("time"), WriteNullableChunk(*TimeFile, *TimeValidFile, Group.Times));
+	Chunks->SetObjectField(TEXT("int"), WriteNullableChunk(*IntFile, *IntValidFile, Group.Ints));
+	Chunks->SetObjectField(TEXT("float"), WriteNullableChunk(*FloatFile, *FloatValidFile, Group.Floats));
+	Chunks->SetObjectField(TEXT("vector"), WriteNullableChunk(*VectorFile, *VectorValidFile, Group.Vectors));
+
+	TSharedRef<FJsonObject> RowGroup = MakeShared<FJsonObject>();
+	RowGroup->SetNumberField(TEXT("firstRow"), NumRows);
+	RowGroup->SetNumberField(TEXT("rows"), Group.Num());
+	RowGroup->SetObjectField(TEXT("columns"), Chunks);
+	RowGroups.Add(MakeShared<FJsonValueObject>(RowGroup));
+
+	NumRows += Group.Num();
+	NumInts += Group.Ints.Values.Num();
+	NumFloats += Group.Floats.Values.Num();
+	NumVectors += Group.Vectors.Values.Num();
+	Group.Reset();
+}
+
+bool FExportWriter::Finish(const TArray<FString>& Inputs)
+{
+	WriteRowGroup();
+
+	bool bWritten = true;
+	TUniquePtr<FArchive>* Files[] = {
+		&LevelFile, &NetFile, &ContextFile, &TemplateFile, &TimeFile, &TimeValidFile,
+		&IntFile, &IntValidFile, &FloatFile, &FloatValidFile, &VectorFile, &VectorValidFile
+	};
+	for (TUniquePtr<FArchive>* File : Files)
+	{
+		bWritten &= (*File)->Close();
+		File->Reset();
+	}
+
+	// The level dictionary is the whole enum in value order, so level indices compare like levels.
+	TArray<FString> LevelNames;
+	const UEnum* LevelEnum = StaticEnum<ELoggerLevel>();
+	for (int32 Index = 0; Index < LevelEnum->NumEnums() - 1; ++Index)
+	{
+		const int64 Value = LevelEnum->GetValueByIndex(Index);
+		if (LevelNames.Num() <= Value)
+		{
+			LevelNames.SetNum(Value + 1, false);
+		}
+		LevelNames[Value] = LevelEnum->GetNameStringByIndex(Index);
+	}
+
+	// Dictionary indices are unsigned, and each chunk records how many bytes its indices take.
+	TSharedRef<FJsonObject> Columns = MakeShared<FJsonObject>();
+	Columns->SetObjectField(TEXT("level"), MakeColumn(TEXT("level"), TEXT("uint8"), false, true));
+	Columns->SetObjectField(TEXT("net"), MakeColumn(TEXT("net"), TEXT("uint"), false, true));
+	Columns->SetObjectField(TEXT("context"), MakeColumn(TEXT("context"), TEXT("uint"), false, true));
+	Columns->SetObjectField(TEXT("template"), MakeColumn(TEXT("template"), TEXT("uint"), false, true));
+	Columns->SetObjectField(TEXT("time"), MakeColumn(TEXT("time"), TEXT("int64"), true, false));
+	Columns->SetObjectField(TEXT("int"), MakeColumn(TEXT("int"), TEXT("int32"), true, false));
+	Columns->SetObjectField(TEXT("float"), MakeColumn(TEXT("float"), TEXT("float64"), true, false));
+	Columns->SetObjectField(TEXT("vector"), MakeColumn(TEXT("vector"), TEXT("float64x3"), true, false));
+
+	TArray<TSharedPtr<FJsonValue>> Sources;
+	for (const FString& Input : Inputs)
+	{
+		Sources.Add(MakeShared<FJsonValueString>(FPaths::GetCleanFilename(Input)));
+	}
+
+	TSharedRef<FJsonObject> Manifest = MakeShared<FJsonObject>();
+	Manifest->SetStringField(TEXT("format"), TEXT("GronkLogColumns"));
+	Manifest->SetNumberField(TEXT("version"), 2);
+	Manifest->SetStringField(TEXT("byteOrder"), TEXT("little"));
+	Manifest->SetStringField(TEXT("timeUnit"), TEXT("microseconds"));
+	Manifest->SetNumberField(TEXT("rows"), NumRows);
+	Manifest->SetNumberField(TEXT("rowGroupSize"), RowGroupSize);
+	Manifest->SetArrayField(TEXT("sources"), Sources);
+	Manifest->SetObjectField(TEXT("columns"), Columns);
+	Manifest->SetArrayField(TEXT("rowGroups"), RowGroups);
+
+	bWritten &= SaveDictionary(LevelNames, FPaths::Combine(OutputDir, TEXT("level.dict.json")));
+	bWritten &= SaveDictionary(NetDictionary.Values, FPaths::Combine(OutputDir, TEXT("net.dict.json")));
+	bWritten &= SaveDictionary(ContextDictionary.Values, FPaths::Combine(OutputDir, TEXT("context.dict.json")));
+	bWritten &= SaveDictionary(TemplateDictionary.Values, FPaths::Combine(OutputDir, TEXT("template.dict.json")));
+	bWritten &= SaveJson(Manifest, FPaths::Combine(OutputDir, TEXT("manifest.json")));
+	return bWritten;
+}
+
+void FExportWriter::LogSummary() const
+{
+	UE_LOG(LogLoggerExport, Display, TEXT("Exported %lld rows in %d row groups to %s (%d contexts, %d templates, %lld ints, %lld floats, %lld vectors)"),
+		NumRows, RowGroups.Num(), *OutputDir, ContextDictionary.Values.Num(), TemplateDictionary.Values.Num(),
+		NumInts, NumFloats, NumVectors);
+}
+
+/**
+ * @brief Streams a text or JSON Lines log into the writer.
+ *
+ * @param FilePath	The log to read.
+ * @param Writer	The writer to add rows to.
+ * @return True if the file was read.
+ */
+static bool ReadLog(const FString& FilePath, FExportWriter& Writer)
+{
+	FLoggerLogStream Stream(FilePath);
+	if (!Stream.IsValid())
+	{
+		return false;
+	}
+
+	FLoggerLogLine Line;
+	while (Stream.Next(Line))
+	{
+		Writer.AddRow(Line.Time.GetPtrOrNull(), Line.Level, Line.Net, Line.Context, Line.Message, true);
+	}
+
+	if (Stream.GetNumInvalid() > 0)
+	{
+		UE_LOG(LogLoggerExport, Warning, TEXT("Skipped %d invalid JSON lines in %s"), Stream.GetNumInvalid(), *FilePath);
+	}
+	return true;
+}
+
+/**
+ * @brief Reads a trace written by "gronk.log.Trace.Stop". The context of each row is the caller's class.
+ *
+ * Traces are compact binary captures, so they are loaded whole and only their rows are streamed.
+ *
+ * @param FilePath	The trace to read.
+ * @param Writer	The writer to add rows to.
+ * @return True if the file was a valid trace.
+ */
+static bool ReadTrace(const FString& FilePath, FExportWriter& Writer)
+{
+	FLoggerTraceData Trace;
+	if (!FLoggerTrace::Load(FilePath, Trace))
+	{
+		return false;
+	}
+
+	int64 Microseconds = 0;
+	for (const FLoggerTraceEvent& Event : Trace.Events)
+	{
+		Microseconds += Event.DeltaMicroseconds;
+		Writer.AddRow(&Microseconds, Event.Level, FString(), Trace.Strings[Event.ClassIndex], Trace.Strings[Event.TemplateIndex], false);
+	}
+	return true;
+}
+
+ULoggerExportCommandlet::ULoggerExportCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 ULoggerExportCommandlet::Main(const FString& Params)
+{
+	FString InputList;
+	if (!FParse::Value(*Params, TEXT("Input="), InputList, false))
+	{
+		UE_LOG(LogLoggerExport, Error, TEXT("Usage: -run=LoggerExport -Input=<File>[,<File>...] [-Output=<Directory>] [-RowGroupSize=<N>]"));
+		return 1;
+	}
+
+	TArray<FString> Inputs;
+	InputList.ParseIntoArray(Inputs, TEXT(","));
+	if (Inputs.IsEmpty())
+	{
+		UE_LOG(LogLoggerExport, Error, TEXT("No inputs given"));
+		return 1;
+	}
+
+	FString OutputDir;
+	if (!FParse::Value(*Params, TEXT("Output="), OutputDir))
+	{
+		OutputDir = FPaths::Combine(FPaths::GetPath(Inputs[0]), FPaths::GetBaseFilename(Inputs[0]) + TEXT(".columns"));
+	}
+
+	int32 RowGroupSize = 64 * 1024;
+	FParse::Value(*Params, TEXT("RowGroupSize="), RowGroupSize);
+
+	FExportWriter Writer(OutputDir, RowGroupSize);
+	if (!Writer.Open())
+	{
+		UE_LOG(LogLoggerExport, Error, TEXT("Could not create the column files in %s"), *OutputDir);
+		return 1;
+	}
+
+	// Stream every input into the writer. Traces are told apart by their extension.
+	for (const FString& Input : Inputs)
+	{
+		const FString Extension = FPaths::GetExtension(Input);
+		const bool bRead = Extension == TEXT("gltrace") ? ReadTrace(Input, Writer) : ReadLog(Input, Writer);
+		if (!bRead)
+		{
+			UE_LOG(LogLoggerExport, Error, TEXT("Could not read %s"), *Input);
+			return 1;
+		}
+	}
+
+	if (!Writer.Finish(Inputs))
+	{
+		UE_LOG(LogLoggerExport, Error, TEXT("Failed to write the columns to %s"), *OutputDir);
+		return 1;
+	}
+
+	Writer.LogSummary();
+	return 0;
+}
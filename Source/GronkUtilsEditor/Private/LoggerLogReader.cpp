@@ -0,0 +1,219 @@
+/**
+ * @file		LoggerLogReader.cpp
+ * @brief		Reads the logs written by the file outputs back into records.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerLogReader.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "String/Find.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogLoggerLogReader, Log, All);
+
+// The number of bytes read from the file at once.
+static constexpr int32 ReadChunkSize = 1024 * 1024;
+
+FLoggerLogStream::FLoggerLogStream(const FString& FilePath)
+	: Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath))
+	, bJson(FPaths::GetExtension(FilePath) == TEXT("jsonl"))
+{
+}
+
+bool FLoggerLogStream::Next(FLoggerLogLine& OutLine)
+{
+	FString Line;
+	FLoggerLogLine Parsed;
+
+	while (ReadLine(Line))
+	{
+		if (bJson)
+		{
+			if (Line.IsEmpty())
+			{
+				continue;
+			}
+			if (ParseJsonLine(Line, OutLine))
+			{
+				return true;
+			}
+			++NumInvalid;
+			continue;
+		}
+
+		if (ParseTextLine(Line, Parsed))
+		{
+			const bool bHadPending = bHasPending;
+			Swap(Pending, Parsed);
+			bHasPending = true;
+			if (bHadPending)
+			{
+				OutLine = MoveTemp(Parsed);
+				return true;
+			}
+		}
+		else if (bHasPending)
+		{
+			Pending.Message.AppendChar(TEXT('\n'));
+			Pending.Message.Append(Line);
+		}
+	}
+
+	if (bHasPending)
+	{
+		OutLine = MoveTemp(Pending);
+		bHasPending = false;
+		return true;
+	}
+	return false;
+}
+
+bool FLoggerLogStream::ReadLine(FString& OutLine)
+{
+	if (!Handle)
+	{
+		return false;
+	}
+
+	int32 LineEnd = INDEX_NONE;
+	while (true)
+	{
+		for (int32 Index = BufferPosition; Index < Buffer.Num(); ++Index)
+		{
+			if (Buffer[Index] == '\n')
+			{
+				LineEnd = Index;
+				break;
+			}
+		}
+		if (LineEnd != INDEX_NONE)
+		{
+			break;
+		}
+
+		// Keep the partial line and read the next chunk after it.
+		const int64 Remaining = Handle->Size() - Handle->Tell();
+		if (Remaining <= 0)
+		{
+			break;
+		}
+		Buffer.RemoveAt(0, BufferPosition, false);
+		BufferPosition = 0;
+
+		const int32 Offset = Buffer.Num();
+		const int32 ChunkSize = static_cast<int32>(FMath::Min<int64>(Remaining, ReadChunkSize));
+		Buffer.AddUninitialized(ChunkSize);
+		if (!Handle->Read(Buffer.GetData() + Offset, ChunkSize))
+		{
+			Buffer.SetNum(Offset, false);
+			break;
+		}
+
+		// Skip the byte order mark of a UTF‑8 file.
+		if (Handle->Tell() == ChunkSize && ChunkSize >= 3 && Buffer[0] == 0xEF && Buffer[1] == 0xBB && Buffer[2] == 0xBF)
+		{
+			BufferPosition = 3;
+		}
+	}
+
+	if (LineEnd == INDEX_NONE)
+	{
+		// The last line of the file may have no terminator.
+		if (BufferPosition >= Buffer.Num())
+		{
+			return false;
+		}
+		LineEnd = Buffer.Num();
+	}
+
+	int32 LineLength = LineEnd - BufferPosition;
+	if (LineLength > 0 && Buffer[BufferPosition + LineLength - 1] == '\r')
+	{
+		--LineLength;
+	}
+
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Buffer.GetData() + BufferPosition), LineLength);
+	OutLine = FString(Converted.Length(), Converted.Get());
+	BufferPosition = FMath::Min(LineEnd + 1, Buffer.Num());
+	return true;
+}
+
+bool FLoggerLogStream::ParseTextLine(const FString& Line, FLoggerLogLine& OutLine)
+{
+	// Lines start with "[ELoggerLevel::Level]\tContext: ".
+	int32 LevelEnd = INDEX_NONE;
+	if (!Line.StartsWith(TEXT("["), ESearchCase::CaseSensitive) || !Line.FindChar(TEXT(']'), LevelEnd) || LevelEnd + 1 >= Line.Len() || Line[LevelEnd + 1] != TEXT('\t'))
+	{
+		return false;
+	}
+
+	const int64 LevelValue = StaticEnum<ELoggerLevel>()->GetValueByNameString(Line.Mid(1, LevelEnd - 1));
+	const FStringView Rest = FStringView(Line).Mid(LevelEnd + 2);
+	const int32 ContextEnd = UE::String::FindFirst(Rest, TEXT(": "));
+	if (LevelValue == INDEX_NONE || ContextEnd == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutLine.Time.Reset();
+	OutLine.Level = static_cast<ELoggerLevel>(LevelValue);
+	OutLine.Net.Reset();
+	OutLine.Context = FString(Rest.Left(ContextEnd));
+	OutLine.Message = FString(Rest.Mid(ContextEnd + 2));
+	return true;
+}
+
+bool FLoggerLogStream::ParseJsonLine(const FString& Line, FLoggerLogLine& OutLine)
+{
+	TSharedPtr<FJsonObject> Object;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Line);
+	if (!FJsonSerializer::Deserialize(Reader, Object) || !Object.IsValid())
+	{
+		return false;
+	}
+
+	FString TimeString, LevelString;
+	OutLine = FLoggerLogLine();
+	Object->TryGetStringField(TEXT("time"), TimeString);
+	Object->TryGetStringField(TEXT("level"), LevelString);
+	Object->TryGetStringField(TEXT("net"), OutLine.Net);
+	Object->TryGetStringField(TEXT("context"), OutLine.Context);
+	Object->TryGetStringField(TEXT("message"), OutLine.Message);
+
+	FDateTime Time;
+	if (FDateTime::ParseIso8601(*TimeString, Time))
+	{
+		OutLine.Time = (Time - FDateTime(1970, 1, 1)).GetTicks() / ETimespan::TicksPerMicrosecond;
+	}
+
+	const int64 LevelValue = StaticEnum<ELoggerLevel>()->GetValueByNameString(LevelString);
+	if (LevelValue != INDEX_NONE)
+	{
+		OutLine.Level = static_cast<ELoggerLevel>(LevelValue);
+	}
+	return true;
+}
+
+bool FLoggerLogReader::Read(const FString& FilePath, TFunctionRef<void(const FLoggerLogLine& Line)> Visitor)
+{
+	FLoggerLogStream Stream(FilePath);
+	if (!Stream.IsValid())
+	{
+		return false;
+	}
+
+	FLoggerLogLine Line;
+	while (Stream.Next(Line))
+	{
+		Visitor(Line);
+	}
+
+	if (Stream.GetNumInvalid() > 0)
+	{
+		UE_LOG(LogLoggerLogReader, Warning, TEXT("Skipped %d invalid lines in %s"), Stream.GetNumInvalid(), *FilePath);
+	}
+	return true;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file		LoggerLogReader.h
+ * @brief		Reads the logs written by the file outputs back into records.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "LoggerLibrary.h"
+
+/**
+ * @struct FLoggerLogLine
+ * @brief A record read back from a log.
+ */
+struct FLoggerLogLine
+{
+	/** Microseconds since the Unix epoch. Only JSON Lines logs record time. */
+	TOptional<int64> Time;
+
+	ELoggerLevel Level = ELoggerLevel::Log;
+
+	/** The net mode label. Only JSON Lines logs record it. */
+	FString Net;
+
+	FString Context;
+	FString Message;
+};
+
+/**
+ * @class FLoggerLogStream
+ * @brief Reads a text log or a JSON Lines log one record at a time, holding only a small buffer of the file.
+ *
+ * ".jsonl" files are read as JSON Lines, skipping invalid lines, and anything else as text written
+ * by the file output, where lines without a prefix continue the previous message.
+ */
+class FLoggerLogStream
+{
+public:
+	/**
+	 * @param FilePath The log to read.
+	 */
+	explicit FLoggerLogStream(const FString& FilePath);
+
+	/** @return True if the file was opened. */
+	bool IsValid() const { return Handle.IsValid(); }
+
+	/**
+	 * @brief Reads the next record.
+	 *
+	 * @param OutLine The record.
+	 * @return False at the end of the file.
+	 */
+	bool Next(FLoggerLogLine& OutLine);
+
+	/** @return The number of JSON lines skipped because they were invalid. */
+	int32 GetNumInvalid() const { return NumInvalid; }
+
+private:
+	/**
+	 * @brief Reads the next line of the file, without its terminator.
+	 *
+	 * @param OutLine The line.
+	 * @return False at the end of the file.
+	 */
+	bool ReadLine(FString& OutLine);
+
+	/**
+	 * @brief Parses a line of a text log that starts a record.
+	 *
+	 * @param Line		The line.
+	 * @param OutLine	The record the line starts.
+	 * @return False if the line continues the previous record.
+	 */
+	static bool ParseTextLine(const FString& Line, FLoggerLogLine& OutLine);
+
+	/**
+	 * @brief Parses a line of a JSON Lines log.
+	 *
+	 * @param Line		The line.
+	 * @param OutLine	The record.
+	 * @return False if the line is not a valid record.
+	 */
+	static bool ParseJsonLine(const FString& Line, FLoggerLogLine& OutLine);
+
+	TUniquePtr<IFileHandle> Handle;
+
+	/** Whether the file is JSON Lines rather than text. */
+	bool bJson = false;
+
+	/** The bytes read from the file and not yet split into lines. */
+	TArray<uint8> Buffer;
+
+	/** The position of the first unconsumed byte in the buffer. */
+	int32 BufferPosition = 0;
+
+	/** The record started by the last line read, which later lines may still continue. Text only. */
+	FLoggerLogLine Pending;
+	bool bHasPending = false;
+
+	int32 NumInvalid = 0;
+};
+
+/**
+ * @class FLoggerLogReader
+ * @brief Reads whole logs, for the offline commandlets.
+ */
+class FLoggerLogReader
+{
+public:
+	/**
+	 * @brief Reads a log, treating ".jsonl" files as JSON Lines and anything else as text.
+	 *
+	 * @param FilePath	The log to read.
+	 * @param Visitor	Called with every record, in order.
+	 * @return True if the file was read.
+	 */
+	static bool Read(const FString& FilePath, TFunctionRef<void(const FLoggerLogLine& Line)> Visitor);
+};
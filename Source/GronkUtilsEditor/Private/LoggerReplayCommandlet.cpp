@@ -0,0 +1,174 @@
+/**
+ * @file		LoggerReplayCommandlet.cpp
+ * @brief		Replays a captured logging trace against the logging pipeline and measures it.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerReplayCommandlet.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "LoggerAllocationScope.h"
+#include "LoggerLibrary.h"
+#include "LoggerSink.h"
+#include "LoggerTrace.h"
+#include "Math/RandomStream.h"
+#include "Misc/Parse.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogLoggerReplay, Log, All);
+
+/**
+ * @brief Gets a percentile of sorted samples.
+ *
+ * @param Sorted		The samples, in ascending order.
+ * @param Percentile	The percentile, between 0 and 1.
+ * @return The sample at the percentile.
+ */
+static uint64 GetPercentile(const TArray<uint64>& Sorted, double Percentile)
+{
+	if (Sorted.Num() == 0)
+	{
+		return 0;
+	}
+	const int32 Index = FMath::Clamp(FMath::FloorToInt32(Percentile * (Sorted.Num() - 1)), 0, Sorted.Num() - 1);
+	return Sorted[Index];
+}
+
+/**
+ * @brief Replays one call through the matching library function.
+ *
+ * @param Event		The traced call.
+ * @param Caller	The object to call as.
+ * @param Template	The traced message.
+ * @param Random	The stream values are drawn from.
+ */
+static void ReplayCall(const FLoggerTraceEvent& Event, UObject* Caller, const FString& Template, FRandomStream& Random)
+{
+	switch (Event.Call)
+	{
+		case ELoggerTraceCall::Message:		ULoggerLibrary::LogMessage(Caller, Template, Event.Level); break;
+		case ELoggerTraceCall::Bool:		ULoggerLibrary::LogBool(Caller, Template, Random.GetFraction() < 0.5f, Event.Level); break;
+		case ELoggerTraceCall::Int:			ULoggerLibrary::LogInt(Caller, Template, Random.RandRange(-1000, 100000), Event.Level); break;
+		case ELoggerTraceCall::Float:		ULoggerLibrary::LogFloat(Caller, Template, Random.FRandRange(-1000.f, 1000.f), Event.Level); break;
+		case ELoggerTraceCall::Vector:		ULoggerLibrary::LogVector(Caller, Template, Random.GetUnitVector() * 1000.0, Event.Level); break;
+		case ELoggerTraceCall::Rotator:		ULoggerLibrary::LogRotator(Caller, Template, Random.GetUnitVector().Rotation(), Event.Level); break;
+		case ELoggerTraceCall::Transform:	ULoggerLibrary::LogTransform(Caller, Template, FTransform(Random.GetUnitVector().Rotation(), Random.GetUnitVector() * 1000.0), Event.Level); break;
+		case ELoggerTraceCall::Object:		ULoggerLibrary::LogObject(Caller, Template, Caller, Event.Level); break;
+		default:							break;
+	}
+}
+
+ULoggerReplayCommandlet::ULoggerReplayCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 ULoggerReplayCommandlet::Main(const FString& Params)
+{
+	FString TracePath;
+	if (!FParse::Value(*Params, TEXT("Trace="), TracePath))
+	{
+		UE_LOG(LogLoggerReplay, Error, TEXT("Usage: -run=LoggerReplay -Trace=<File> [-MaxSpeed] [-Repeat=<N>] [-Outputs=OutputLog,OnScreen,File,Json]"));
+		return 1;
+	}
+
+	const bool bMaxSpeed = FParse::Param(*Params, TEXT("MaxSpeed"));
+	int32 Repeat = 1;
+	FParse::Value(*Params, TEXT("Repeat="), Repeat);
+	Repeat = FMath::Max(Repeat, 1);
+
+	FLoggerTraceData Trace;
+	if (!FLoggerTrace::Load(TracePath, Trace))
+	{
+		UE_LOG(LogLoggerReplay, Error, TEXT("Could not load the trace %s"), *TracePath);
+		return 1;
+	}
+
+	// Only the listed outputs receive records, so the replay can measure one output at a time.
+	FString Outputs;
+	if (FParse::Value(*Params, TEXT("Outputs="), Outputs, false))
+	{
+		const UEnum* OutputEnum = StaticEnum<ELoggerOutput>();
+		for (int32 Index = 0; Index < OutputEnum->NumEnums() - 1; ++Index)
+		{
+			const FString Name = OutputEnum->GetNameStringByIndex(Index);
+			ULoggerLibrary::SetOutputEnabled(static_cast<ELoggerOutput>(OutputEnum->GetValueByIndex(Index)), Outputs.Contains(Name));
+		}
+	}
+
+	// Call as the default object of each traced class, loading Blueprint classes as needed.
+	TMap<int32, UObject*> Callers;
+	for (const FLoggerTraceEvent& Event : Trace.Events)
+	{
+		if (!Callers.Contains(Event.ClassIndex))
+		{
+			const FString& ClassPath = Trace.Strings[Event.ClassIndex];
+			UClass* Class = ClassPath.IsEmpty() ? nullptr : LoadObject<UClass>(nullptr, *ClassPath);
+			Callers.Add(Event.ClassIndex, Class ? Class->GetDefaultObject() : UObject::StaticClass()->GetDefaultObject());
+		}
+	}
+
+	TArray<uint64> LatencyCycles;
+	LatencyCycles.Reserve(Trace.Events.Num() * Repeat);
+
+	double CallSeconds = 0.0;
+	double TotalSeconds = 0.0;
+	uint64 CallAllocations = 0;
+	uint64 CallBytes = 0;
+	{
+		FLoggerAllocationScope AllocationScope;
+
+		FRandomStream Random(0);
+		const double StartTime = FPlatformTime::Seconds();
+		double ScheduledTime = StartTime;
+
+		for (int32 Pass = 0; Pass < Repeat; ++Pass)
+		{
+			for (const FLoggerTraceEvent& Event : Trace.Events)
+			{
+				if (!bMaxSpeed)
+				{
+					// Sleep through long gaps and spin through the last millisecond to keep the recorded timing.
+					ScheduledTime += Event.DeltaMicroseconds * 1e-6;
+					for (double Remaining = ScheduledTime - FPlatformTime::Seconds(); Remaining > 0.0; Remaining = ScheduledTime - FPlatformTime::Seconds())
+					{
+						if (Remaining > 0.002)
+						{
+							FPlatformProcess::Sleep(static_cast<float>(Remaining - 0.001));
+						}
+					}
+				}
+
+				const uint64 CallStart = FPlatformTime::Cycles64();
+				ReplayCall(Event, Callers.FindChecked(Event.ClassIndex), Trace.Strings[Event.TemplateIndex], Random);
+				LatencyCycles.Add(FPlatformTime::Cycles64() - CallStart);
+			}
+		}
+
+		CallSeconds = FPlatformTime::Seconds() - StartTime;
+		CallAllocations = AllocationScope.GetNumAllocations();
+		CallBytes = AllocationScope.GetNumBytes();
+
+		FLoggerSinks::Flush();
+		TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	LatencyCycles.Sort();
+	const int64 NumCalls = LatencyCycles.Num();
+	const double ToMicroseconds = FPlatformTime::GetSecondsPerCycle64() * 1e6;
+
+	UE_LOG(LogLoggerReplay, Display, TEXT("Replayed %lld calls (%d strings, %d passes) at %s"), NumCalls, Trace.Strings.Num(), Repeat, bMaxSpeed ? TEXT("max speed") : TEXT("1x"));
+	UE_LOG(LogLoggerReplay, Display, TEXT("  throughput:  %.0f calls/s (%.3f s calling, %.3f s including the final flush)"), NumCalls / FMath::Max(CallSeconds, UE_DOUBLE_SMALL_NUMBER), CallSeconds, TotalSeconds);
+	UE_LOG(LogLoggerReplay, Display, TEXT("  latency:     p50= %.2f us p99= %.2f us p99.9= %.2f us max= %.2f us"),
+		GetPercentile(LatencyCycles, 0.5) * ToMicroseconds,
+		GetPercentile(LatencyCycles, 0.99) * ToMicroseconds,
+		GetPercentile(LatencyCycles, 0.999) * ToMicroseconds,
+		GetPercentile(LatencyCycles, 1.0) * ToMicroseconds);
+	UE_LOG(LogLoggerReplay, Display, TEXT("  allocations: %.2f per call, %.1f bytes per call"),
+		NumCalls > 0 ? static_cast<double>(CallAllocations) / NumCalls : 0.0,
+		NumCalls > 0 ? static_cast<double>(CallBytes) / NumCalls : 0.0);
+
+	return 0;
+}
@@ -0,0 +1,191 @@
+/**
+ * @file		LoggerTemplateMiningCommandlet.cpp
+ * @brief		Clusters logged messages into templates to find the log sites worth converting.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerTemplateMiningCommandlet.h"
+#include "Dom/JsonObject.h"
+#include "LoggerDrain.h"
+#include "LoggerLogReader.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogLoggerTemplateMining, Log, All);
+
+// The number of contexts reported per template.
+static constexpr int32 NumTopContexts = 3;
+
+/**
+ * @brief Gets the contexts that logged the most messages into a cluster.
+ *
+ * @param Cluster The cluster.
+ * @return The contexts and their counts, most first.
+ */
+static TArray<TPair<FString, uint64>> GetTopContexts(const FLoggerDrainCluster& Cluster)
+{
+	TArray<TPair<FString, uint64>> Contexts = Cluster.Contexts.Array();
+	Contexts.Sort([](const TPair<FString, uint64>& A, const TPair<FString, uint64>& B) { return A.Value > B.Value; });
+	Contexts.SetNum(FMath::Min(Contexts.Num(), NumTopContexts), false);
+	return Contexts;
+}
+
+/**
+ * @brief Logs a ranking of clusters.
+ *
+ * @param Title		The title of the ranking.
+ * @param Ranked	The clusters, ranked.
+ * @param Num		The number of clusters to log.
+ * @param TotalCount	The number of messages over all clusters.
+ * @param TotalBytes	The number of bytes over all clusters.
+ */
+static void LogRanking(const TCHAR* Title, const TArray<const FLoggerDrainCluster*>& Ranked, int32 Num, uint64 TotalCount, uint64 TotalBytes)
+{
+	UE_LOG(LogLoggerTemplateMining, Display, TEXT("%s"), Title);
+	UE_LOG(LogLoggerTemplateMining, Display, TEXT("  %4s %10s %7s %12s %7s  %s"), TEXT("#"), TEXT("Records"), TEXT("%"), TEXT("Bytes"), TEXT("%"), TEXT("Template"));
+
+	for (int32 Rank = 0; Rank < FMath::Min(Num, Ranked.Num()); ++Rank)
+	{
+		const FLoggerDrainCluster& Cluster = *Ranked[Rank];
+		UE_LOG(LogLoggerTemplateMining, Display, TEXT("  %4d %10llu %6.2f%% %12llu %6.2f%%  %s"),
+			Rank + 1,
+			Cluster.Count, TotalCount > 0 ? 100.0 * Cluster.Count / TotalCount : 0.0,
+			Cluster.Bytes, TotalBytes > 0 ? 100.0 * Cluster.Bytes / TotalBytes : 0.0,
+			*Cluster.GetTemplate());
+
+		FString Contexts;
+		for (const TPair<FString, uint64>& Context : GetTopContexts(Cluster))
+		{
+			Contexts += FString::Printf(TEXT("%s%s (%llu)"), Contexts.IsEmpty() ? TEXT("") : TEXT(", "), *Context.Key, Context.Value);
+		}
+		UE_LOG(LogLoggerTemplateMining, Display, TEXT("  %4s e.g. \"%s\" from %s"), TEXT(""), *Cluster.Example, *Contexts);
+	}
+}
+
+/**
+ * @brief Describes a cluster in the JSON report.
+ *
+ * @param Cluster The cluster.
+ * @return The description of the cluster.
+ */
+static TSharedRef<FJsonObject> MakeClusterJson(const FLoggerDrainCluster& Cluster)
+{
+	int32 NumVariables = 0;
+	for (const FString& Token : Cluster.Tokens)
+	{
+		NumVariables += Token == FLoggerDrain::Wildcard ? 1 : 0;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Contexts;
+	for (const TPair<FString, uint64>& Context : GetTopContexts(Cluster))
+	{
+		TSharedRef<FJsonObject> ContextObject = MakeShared<FJsonObject>();
+		ContextObject->SetStringField(TEXT("context"), Context.Key);
+		ContextObject->SetNumberField(TEXT("records"), Context.Value);
+		Contexts.Add(MakeShared<FJsonValueObject>(ContextObject));
+	}
+
+	TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+	Object->SetStringField(TEXT("template"), Cluster.GetTemplate());
+	Object->SetNumberField(TEXT("variables"), NumVariables);
+	Object->SetNumberField(TEXT("records"), Cluster.Count);
+	Object->SetNumberField(TEXT("bytes"), Cluster.Bytes);
+	Object->SetStringField(TEXT("example"), Cluster.Example);
+	Object->SetArrayField(TEXT("contexts"), Contexts);
+	return Object;
+}
+
+ULoggerTemplateMiningCommandlet::ULoggerTemplateMiningCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 ULoggerTemplateMiningCommandlet::Main(const FString& Params)
+{
+	FString InputList;
+	TArray<FString> Inputs;
+	if (FParse::Value(*Params, TEXT("Input="), InputList, false))
+	{
+		InputList.ParseIntoArray(Inputs, TEXT(","));
+	}
+	if (Inputs.IsEmpty())
+	{
+		UE_LOG(LogLoggerTemplateMining, Error, TEXT("Usage: -run=LoggerTemplateMining -Input=<File>[,<File>...] [-Top=<N>] [-Depth=<N>] [-Similarity=<0-1>] [-MaxChildren=<N>] [-Output=<File>]"));
+		return 1;
+	}
+
+	int32 Top = 20;
+	int32 Depth = 4;
+	double Similarity = 0.4;
+	int32 MaxChildren = 100;
+	FParse::Value(*Params, TEXT("Top="), Top);
+	FParse::Value(*Params, TEXT("Depth="), Depth);
+	FParse::Value(*Params, TEXT("Similarity="), Similarity);
+	FParse::Value(*Params, TEXT("MaxChildren="), MaxChildren);
+
+	FLoggerDrain Drain(Depth, Similarity, MaxChildren);
+	for (const FString& Input : Inputs)
+	{
+		const bool bRead = FLoggerLogReader::Read(Input, [&Drain](const FLoggerLogLine& Line)
+		{
+			Drain.Add(Line.Message, Line.Context);
+		});
+		if (!bRead)
+		{
+			UE_LOG(LogLoggerTemplateMining, Error, TEXT("Could not read %s"), *Input);
+			return 1;
+		}
+	}
+
+	const TArray<FLoggerDrainCluster>& Clusters = Drain.GetClusters();
+	uint64 TotalCount = 0;
+	uint64 TotalBytes = 0;
+	TArray<const FLoggerDrainCluster*> ByCount;
+	ByCount.Reserve(Clusters.Num());
+	for (const FLoggerDrainCluster& Cluster : Clusters)
+	{
+		TotalCount += Cluster.Count;
+		TotalBytes += Cluster.Bytes;
+		ByCount.Add(&Cluster);
+	}
+
+	TArray<const FLoggerDrainCluster*> ByBytes = ByCount;
+	ByCount.Sort([](const FLoggerDrainCluster& A, const FLoggerDrainCluster& B) { return A.Count > B.Count; });
+	ByBytes.Sort([](const FLoggerDrainCluster& A, const FLoggerDrainCluster& B) { return A.Bytes > B.Bytes; });
+
+	UE_LOG(LogLoggerTemplateMining, Display, TEXT("Mined %d templates from %llu records (%llu message bytes)"), Clusters.Num(), TotalCount, TotalBytes);
+	LogRanking(TEXT("Top templates by records:"), ByCount, Top, TotalCount, TotalBytes);
+	LogRanking(TEXT("Top templates by bytes:"), ByBytes, Top, TotalCount, TotalBytes);
+
+	FString OutputPath;
+	if (FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		TArray<TSharedPtr<FJsonValue>> Templates;
+		for (const FLoggerDrainCluster* Cluster : ByBytes)
+		{
+			Templates.Add(MakeShared<FJsonValueObject>(MakeClusterJson(*Cluster)));
+		}
+
+		TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+		Report->SetNumberField(TEXT("records"), TotalCount);
+		Report->SetNumberField(TEXT("bytes"), TotalBytes);
+		Report->SetArrayField(TEXT("templates"), Templates);
+
+		FString Json;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+		FJsonSerializer::Serialize(Report, Writer);
+		if (!FFileHelper::SaveStringToFile(Json, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogLoggerTemplateMining, Error, TEXT("Failed to write the report to %s"), *OutputPath);
+			return 1;
+		}
+		UE_LOG(LogLoggerTemplateMining, Display, TEXT("Wrote every template, by bytes, to %s"), *OutputPath);
+	}
+
+	return 0;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file		LoggerDrainTests.cpp
+ * @brief		Automation tests for the Drain template miner.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#include "LoggerDrain.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoggerDrainNumericMessagesTest, "GronkUtils.Logger.Drain.NumericMessages",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FLoggerDrainNumericMessagesTest::RunTest(const FString& Parameters)
+{
+	// Tokens with digits are masked up front, so a numeric message must still match its own template.
+	FLoggerDrain Drain(4, 0.4, 100);
+	for (int32 Index = 0; Index < 100; ++Index)
+	{
+		Drain.Add(TEXT("Pos: X=1.0 Y=2.0 Z=3.0"), TEXT("Pawn"));
+	}
+	for (int32 Index = 0; Index < 100; ++Index)
+	{
+		Drain.Add(FString::Printf(TEXT("Pos: X=%d.5 Y=%d.25 Z=0.0"), Index, Index * 2), TEXT("Pawn"));
+	}
+
+	const TArray<FLoggerDrainCluster>& Clusters = Drain.GetClusters();
+	if (!TestEqual(TEXT("Repeated numeric messages collapse into one cluster"), Clusters.Num(), 1))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Every message is counted"), Clusters[0].Count, static_cast<uint64>(200));
+	TestEqual(TEXT("Template"), Clusters[0].GetTemplate(), FString(TEXT("Pos: <*> <*> <*>")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoggerDrainDistinctMessagesTest, "GronkUtils.Logger.Drain.DistinctMessages",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FLoggerDrainDistinctMessagesTest::RunTest(const FString& Parameters)
+{
+	FLoggerDrain Drain(4, 0.4, 100);
+	Drain.Add(TEXT("Spawned enemy at 12"), TEXT("Spawner"));
+	Drain.Add(TEXT("Spawned enemy at 40"), TEXT("Spawner"));
+	Drain.Add(TEXT("Spawned pickup with 3"), TEXT("Spawner"));
+	Drain.Add(TEXT("Door opened by player"), TEXT("Door"));
+
+	const TArray<FLoggerDrainCluster>& Clusters = Drain.GetClusters();
+	TestEqual(TEXT("Messages with a different shape stay apart"), Clusters.Num(), 3);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,27 @@
+/**
+ * @file 		GronkUtilsEditor.h
+ * @brief 		The editor module for the GronkUtils plugin.
+ * @copyright 	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+class FGronkUtilsEditorModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
+private:
+	/**
+	 * @brief Hooks the editor events that release the "Log Once" latches, once the editor exists.
+	 */
+	void OnPostEngineInit();
+
+	FDelegateHandle PostEngineInitHandle;
+	FDelegateHandle EndPIEHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+};
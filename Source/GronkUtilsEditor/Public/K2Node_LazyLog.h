@@ -0,0 +1,161 @@
+/**
+ * @file		K2Node_LazyLog.h
+ * @brief		Blueprint nodes that only evaluate their message when it will be logged.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node.h"
+#include "K2Node_LazyLog.generated.h"
+
+/**
+ * @class UK2Node_LazyLogBase
+ * @brief Base for logging nodes that place their message graph behind a native gate check.
+ *
+ * The node expands into a call to a gate function on ULoggerLibrary, a branch on its result,
+ * and a call to ULoggerLibrary::LogMessage on the true path. Since the Message pin is only wired
+ * into the LogMessage call, the pure nodes that build the message are only evaluated when the
+ * message will actually be emitted.
+ */
+UCLASS(Abstract)
+class GRONKUTILSEDITOR_API UK2Node_LazyLogBase : public UK2Node
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UEdGraphNode Interface
+	virtual void AllocateDefaultPins() override;
+	virtual FLinearColor GetNodeTitleColor() const override;
+	virtual FSlateIcon GetIconAndTint(FLinearColor& OutColor) const override;
+	//~ End UEdGraphNode Interface
+
+	//~ Begin UK2Node Interface
+	virtual void ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+	virtual FText GetMenuCategory() const override;
+	//~ End UK2Node Interface
+
+	/** @return The pin of the calling object. */
+	UEdGraphPin* GetCallerPin() const;
+
+	/** @return The pin of the message to log. */
+	UEdGraphPin* GetMessagePin() const;
+
+	/** @return The pin of the log level. */
+	UEdGraphPin* GetLevelPin() const;
+
+protected:
+	/** The names of the pins shared by every lazy logging node. */
+	static const FName CallerPinName;
+	static const FName MessagePinName;
+	static const FName LevelPinName;
+
+	/**
+	 * @brief Gets the name of the ULoggerLibrary function that decides whether the message is emitted.
+	 *
+	 * Every input pin of the gate function is fed from the node pin with the same name.
+	 *
+	 * @return The name of the gate function.
+	 */
+	virtual FName GetGateFunctionName() const PURE_VIRTUAL(UK2Node_LazyLogBase::GetGateFunctionName, return NAME_None;);
+
+	/**
+	 * @brief Creates any input pins the node needs between the caller and the message.
+	 */
+	virtual void AllocateConditionPins() {}
+
+	/**
+	 * @brief Gets the name of the gate function's output that selects the outcome exec pin.
+	 *
+	 * Nodes that return NAME_None have a single "Then" output instead of two outcome pins.
+	 *
+	 * @return The name of the gate function's boolean outcome parameter.
+	 */
+	virtual FName GetGateOutcomeParamName() const { return NAME_None; }
+
+	/**
+	 * @brief Gets the names of the outcome exec pins.
+	 *
+	 * @param OutTrueName	The pin taken when the outcome is true.
+	 * @param OutFalseName	The pin taken when the outcome is false.
+	 */
+	virtual void GetOutcomePinNames(FName& OutTrueName, FName& OutFalseName) const {}
+
+	/**
+	 * @brief Gets the display names of the outcome exec pins.
+	 *
+	 * @param OutTrueText	The display name of the true pin.
+	 * @param OutFalseText	The display name of the false pin.
+	 */
+	virtual void GetOutcomePinTexts(FText& OutTrueText, FText& OutFalseText) const {}
+
+	/** @return True if the node has two outcome exec pins instead of "Then". */
+	bool HasOutcomePins() const { return !GetGateOutcomeParamName().IsNone(); }
+};
+
+/**
+ * @class UK2Node_LazyLogMessage
+ * @brief A "Log Message" node that only builds its message when the level is not suppressed.
+ */
+UCLASS()
+class GRONKUTILSEDITOR_API UK2Node_LazyLogMessage : public UK2Node_LazyLogBase
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UEdGraphNode Interface
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	//~ End UEdGraphNode Interface
+
+protected:
+	virtual FName GetGateFunctionName() const override;
+};
+
+/**
+ * @class UK2Node_LazyLogOnValidity
+ * @brief A "Log On Validity" node that only builds its message when the validity condition logs.
+ */
+UCLASS()
+class GRONKUTILSEDITOR_API UK2Node_LazyLogOnValidity : public UK2Node_LazyLogBase
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UEdGraphNode Interface
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	//~ End UEdGraphNode Interface
+
+protected:
+	virtual FName GetGateFunctionName() const override;
+	virtual void AllocateConditionPins() override;
+	virtual FName GetGateOutcomeParamName() const override;
+	virtual void GetOutcomePinNames(FName& OutTrueName, FName& OutFalseName) const override;
+	virtual void GetOutcomePinTexts(FText& OutTrueText, FText& OutFalseText) const override;
+};
+
+/**
+ * @class UK2Node_LazyLogOnCondition
+ * @brief A "Log On Condition" node that only builds its message when the condition logs.
+ */
+UCLASS()
+class GRONKUTILSEDITOR_API UK2Node_LazyLogOnCondition : public UK2Node_LazyLogBase
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UEdGraphNode Interface
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	//~ End UEdGraphNode Interface
+
+protected:
+	virtual FName GetGateFunctionName() const override;
+	virtual void AllocateConditionPins() override;
+	virtual FName GetGateOutcomeParamName() const override;
+	virtual void GetOutcomePinNames(FName& OutTrueName, FName& OutFalseName) const override;
+	virtual void GetOutcomePinTexts(FText& OutTrueText, FText& OutFalseText) const override;
+};
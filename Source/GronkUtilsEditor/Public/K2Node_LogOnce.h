@@ -0,0 +1,52 @@
+/**
+ * @file		K2Node_LogOnce.h
+ * @brief		Blueprint nodes that only log the first time they are reached.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node_LazyLog.h"
+#include "K2Node_LogOnce.generated.h"
+
+/**
+ * @class UK2Node_LogOnce
+ * @brief A "Log Message" node that only logs the first time its call site emits.
+ *
+ * After the first emission the node only costs the latch check; the message is never built again.
+ */
+UCLASS()
+class GRONKUTILSEDITOR_API UK2Node_LogOnce : public UK2Node_LazyLogBase
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UEdGraphNode Interface
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	//~ End UEdGraphNode Interface
+
+protected:
+	virtual FName GetGateFunctionName() const override;
+};
+
+/**
+ * @class UK2Node_LogOncePerObject
+ * @brief A "Log Message" node that logs the first time its call site emits for each object.
+ */
+UCLASS()
+class GRONKUTILSEDITOR_API UK2Node_LogOncePerObject : public UK2Node_LazyLogBase
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UEdGraphNode Interface
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	//~ End UEdGraphNode Interface
+
+protected:
+	virtual FName GetGateFunctionName() const override;
+	virtual void AllocateConditionPins() override;
+};
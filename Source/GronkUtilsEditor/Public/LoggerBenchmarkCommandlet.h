@@ -0,0 +1,35 @@
+/**
+ * @file		LoggerBenchmarkCommandlet.h
+ * @brief		Runs the logging benchmark suite and gates it against a baseline.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "LoggerBenchmarkCommandlet.generated.h"
+
+/**
+ * @class ULoggerBenchmarkCommandlet
+ * @brief Benchmarks the logging library and fails if any metric regressed past its tolerance.
+ *
+ * Usage: -run=LoggerBenchmark [-Baseline=<File>] [-WriteBaseline] [-Output=<File>] [-Iterations=<N>] [-Runs=<N>]
+ *
+ * The baseline defaults to Benchmarks/LoggerBaseline.json in the plugin. Each scenario reports
+ * nanoseconds per call, allocations per call and bytes formatted per record. The commandlet
+ * returns 0 when every metric is within tolerance, 1 on a regression and 2 on an error, so it can
+ * gate a headless build agent, e.g. with -nullrhi -unattended.
+ */
+UCLASS()
+class GRONKUTILSEDITOR_API ULoggerBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULoggerBenchmarkCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
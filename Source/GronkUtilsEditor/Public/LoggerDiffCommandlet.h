@@ -0,0 +1,35 @@
+/**
+ * @file		LoggerDiffCommandlet.h
+ * @brief		Finds where the logs of two runs diverge.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "LoggerDiffCommandlet.generated.h"
+
+/**
+ * @class ULoggerDiffCommandlet
+ * @brief Aligns the records of two logs and reports the points where they diverge.
+ *
+ * Usage: -run=LoggerDiff -A=<File> -B=<File> [-Window=<N>] [-Context=<N>] [-MaxHunks=<N>] [-Output=<File>]
+ *
+ * Records are normalized before they are compared: times are dropped, timestamps in messages are
+ * masked, and the numeric suffixes of object names are stripped, so runs that only differ in
+ * those compare equal. Both logs are streamed, and memory is bounded by the window size. Returns
+ * 0 if the logs match, 1 if they diverge and 2 on an error.
+ */
+UCLASS()
+class GRONKUTILSEDITOR_API ULoggerDiffCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULoggerDiffCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
@@ -0,0 +1,40 @@
+/**
+ * @file		LoggerExportCommandlet.h
+ * @brief		Converts logs into a columnar layout for analytics.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "LoggerExportCommandlet.generated.h"
+
+/**
+ * @class ULoggerExportCommandlet
+ * @brief Converts text logs, JSON Lines logs and traces into one file per column.
+ *
+ * Usage: -run=LoggerExport -Input=<File>[,<File>...] [-Output=<Directory>] [-RowGroupSize=<N>]
+ *
+ * Level, net mode, context and message template are dictionary encoded. The values appended by
+ * "Log Message with Int", "with Float" and "with Vector" are split off their template into typed
+ * columns with validity bitmaps. Rows are cut into row groups, and manifest.json records where each
+ * group lies in every column file along with its min/max stats, so a reader can skip groups and
+ * only read the columns a query touches. Traces carry no values, only templates.
+ *
+ * Inputs are streamed, and each row group is written out as soon as it fills, so only the
+ * dictionaries and one row group are held in memory. Since dictionaries only grow, each chunk of a
+ * dictionary encoded column records the width of its indices.
+ */
+UCLASS()
+class GRONKUTILSEDITOR_API ULoggerExportCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULoggerExportCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
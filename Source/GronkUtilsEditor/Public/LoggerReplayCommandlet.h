@@ -0,0 +1,33 @@
+/**
+ * @file		LoggerReplayCommandlet.h
+ * @brief		Replays a captured logging trace against the logging pipeline and measures it.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "LoggerReplayCommandlet.generated.h"
+
+/**
+ * @class ULoggerReplayCommandlet
+ * @brief Replays a trace written by "gronk.log.Trace.Start" and reports throughput, latency and allocations.
+ *
+ * Usage: -run=LoggerReplay -Trace=<File> [-MaxSpeed] [-Repeat=<N>] [-Outputs=OutputLog,OnScreen,File,Json]
+ *
+ * Calls are replayed through the same Blueprint library functions with synthesized values, by the
+ * default object of the traced caller class. At 1x speed the recorded gaps between calls are kept.
+ */
+UCLASS()
+class GRONKUTILSEDITOR_API ULoggerReplayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULoggerReplayCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
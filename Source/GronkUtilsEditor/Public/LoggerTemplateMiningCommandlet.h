@@ -0,0 +1,35 @@
+/**
+ * @file		LoggerTemplateMiningCommandlet.h
+ * @brief		Clusters logged messages into templates to find the log sites worth converting.
+ * @copyright	Grant Wilk, all rights reserved.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "LoggerTemplateMiningCommandlet.generated.h"
+
+/**
+ * @class ULoggerTemplateMiningCommandlet
+ * @brief Mines message templates from logs with Drain and reports the largest ones.
+ *
+ * Usage: -run=LoggerTemplateMining -Input=<File>[,<File>...] [-Top=<N>] [-Depth=<N>] [-Similarity=<0-1>] [-MaxChildren=<N>] [-Output=<File>]
+ *
+ * Messages built at runtime from values defeat interning and deduplication. Each message is
+ * clustered with others of the same shape, and every cluster keeps a template where the tokens
+ * that vary are "<*>". The templates with the most records and the most bytes are logged along
+ * with the contexts that log them most, and optionally written to a JSON report.
+ */
+UCLASS()
+class GRONKUTILSEDITOR_API ULoggerTemplateMiningCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULoggerTemplateMiningCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};